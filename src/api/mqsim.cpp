@@ -0,0 +1,497 @@
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "mqsim.h"
+#include "../exec/Execution_Parameter_Set.h"
+#include "../exec/SSD_Device.h"
+#include "../exec/Host_System.h"
+#include "../ssd/FTL.h"
+#include "../ssd/NVM_PHY_ONFI.h"
+#include "../ssd/NVM_Transaction_Flash_ER.h"
+#include "../ssd/NVM_Transaction_Flash_RD.h"
+#include "../ssd/NVM_Transaction_Flash_WR.h"
+#include "../utils/Logical_Address_Partitioning_Unit.h"
+#include "../utils/rapidxml/rapidxml.hpp"
+
+//The bookkeeping of a submitted operation until its completion is pushed to the ring
+struct Inflight_op
+{
+	uint64_t Tag;
+	uint64_t Submit_time;
+	uint32_t Type;
+	uint32_t Next_free;
+};
+
+struct mqsim_instance
+{
+	Execution_Parameter_Set Exec_params;//All parameter sets are static members, so a plain member suffices
+	SSD_Device* SSD;
+	Host_System* Host;
+	unsigned int Sectors_per_page;
+	unsigned int Page_capacity;
+	LHA_type First_lba, Last_lba;//The logical address space of stream 0, which serves all logical operations
+	mqsim_completion_ring* Ring;
+	std::deque<mqsim_completion> Overflowed_completions;//Completions that did not fit into the ring
+	std::vector<Inflight_op> Inflight_ops;
+	uint32_t Free_inflight_op;
+	std::vector<SSD_Components::NVM_Transaction_Flash*> Physical_transactions;//Reused by every submission call
+	bool Channel_events_enabled;
+	uint64_t Completion_count;//The number of host-visible events so far, used to detect them during a quantum
+	uint64_t Channel_event_count;
+
+	uint32_t Allocate_inflight_op(uint64_t tag, uint32_t type);
+	void Complete(uint32_t inflight_op_id);
+	void Push_completion(const mqsim_completion& completion);
+	void Flush_overflowed_completions();
+	SSD_Components::User_Request* Create_user_request(uint64_t tag, uint32_t type, uint32_t flags);
+	bool Is_valid_physical_address(const mqsim_physical_address& address, uint32_t type, uint32_t flags);
+	bool Is_valid_logical_address(const mqsim_logical_address& address);
+	bool Create_physical_operation(uint64_t tag, uint32_t type, uint32_t flags, const mqsim_physical_address& address, uint32_t pages);
+	void Submit_physical_transactions();
+};
+
+#define NO_FREE_INFLIGHT_OP 0xffffffff
+
+static thread_local mqsim_instance* thread_instance = NULL;//The engine is a per-thread singleton, so only one instance per thread is allowed
+
+static bool read_file(const char* file_path, std::string& content)
+{
+	std::ifstream file(file_path);
+	if (!file) {
+		return false;
+	}
+	std::stringstream ss;
+	ss << file.rdbuf();
+	content = ss.str();
+
+	return true;
+}
+
+static bool load_ssd_config(const char* ssd_config_file_path, Execution_Parameter_Set* exec_params)
+{
+	std::string content;
+	if (!read_file(ssd_config_file_path, content)) {
+		return false;
+	}
+
+	rapidxml::xml_document<> doc;
+	std::vector<char> temp_string(content.begin(), content.end());
+	temp_string.push_back('\0');
+	doc.parse<0>(temp_string.data());
+	rapidxml::xml_node<> *mqsim_config = doc.first_node("Execution_Parameter_Set");
+	if (mqsim_config == NULL) {
+		return false;
+	}
+	exec_params->XML_deserialize(mqsim_config);
+
+	return true;
+}
+
+//The I/O flows of the first scenario only define the address ranges of the host streams, their requests are never generated
+static bool load_workload_config(const char* workload_defs_file_path, Execution_Parameter_Set* exec_params)
+{
+	std::string content;
+	if (!read_file(workload_defs_file_path, content)) {
+		return false;
+	}
+
+	rapidxml::xml_document<> doc;
+	std::vector<char> temp_string(content.begin(), content.end());
+	temp_string.push_back('\0');
+	doc.parse<0>(temp_string.data());
+	rapidxml::xml_node<> *mqsim_io_scenarios = doc.first_node("MQSim_IO_Scenarios");
+	if (mqsim_io_scenarios == NULL || mqsim_io_scenarios->first_node("IO_Scenario") == NULL) {
+		return false;
+	}
+	for (auto flow_def = mqsim_io_scenarios->first_node("IO_Scenario")->first_node(); flow_def; flow_def = flow_def->next_sibling()) {
+		if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_Synthetic") == 0) {
+			IO_Flow_Parameter_Set_Synthetic* flow = new IO_Flow_Parameter_Set_Synthetic;
+			flow->XML_deserialize(flow_def);
+			exec_params->Host_Configuration.IO_Flow_Definitions.push_back(flow);
+		} else if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_Trace_Based") == 0) {
+			IO_Flow_Parameter_Set_Trace_Based* flow = new IO_Flow_Parameter_Set_Trace_Based;
+			flow->XML_deserialize(flow_def);
+			exec_params->Host_Configuration.IO_Flow_Definitions.push_back(flow);
+		}
+	}
+
+	return exec_params->Host_Configuration.IO_Flow_Definitions.size() > 0;
+}
+
+static void delete_io_flow_definitions(Execution_Parameter_Set* exec_params)
+{
+	for (auto &flow : exec_params->Host_Configuration.IO_Flow_Definitions) {
+		delete flow;
+	}
+	exec_params->Host_Configuration.IO_Flow_Definitions.clear();
+}
+
+uint32_t mqsim_instance::Allocate_inflight_op(uint64_t tag, uint32_t type)
+{
+	uint32_t id = Free_inflight_op;
+	if (id == NO_FREE_INFLIGHT_OP) {
+		id = (uint32_t)Inflight_ops.size();
+		Inflight_ops.push_back(Inflight_op());
+	} else {
+		Free_inflight_op = Inflight_ops[id].Next_free;
+	}
+	Inflight_ops[id].Tag = tag;
+	Inflight_ops[id].Submit_time = Simulator->Time();
+	Inflight_ops[id].Type = type;
+
+	return id;
+}
+
+void mqsim_instance::Complete(uint32_t inflight_op_id)
+{
+	Inflight_op& inflight_op = Inflight_ops[inflight_op_id];
+	mqsim_completion completion;
+	completion.tag = inflight_op.Tag;
+	completion.submit_time = inflight_op.Submit_time;
+	completion.complete_time = Simulator->Time();
+	completion.type = inflight_op.Type;
+	completion.status = MQSIM_STATUS_OK;
+	inflight_op.Next_free = Free_inflight_op;
+	Free_inflight_op = inflight_op_id;
+	Completion_count++;
+	Push_completion(completion);
+}
+
+static void handle_channel_status_change(flash_channel_ID_type channel_id, SSD_Components::BusChannelStatus status)
+{
+	mqsim_instance* sim = thread_instance;
+	if (sim == NULL || !sim->Channel_events_enabled) {
+		return;
+	}
+
+	mqsim_completion event;
+	event.tag = channel_id;
+	event.submit_time = Simulator->Time();
+	event.complete_time = Simulator->Time();
+	event.type = status == SSD_Components::BusChannelStatus::BUSY ? MQSIM_EVENT_CHANNEL_BUSY : MQSIM_EVENT_CHANNEL_IDLE;
+	event.status = MQSIM_STATUS_OK;
+	sim->Channel_event_count++;
+	sim->Push_completion(event);
+}
+
+void mqsim_instance::Push_completion(const mqsim_completion& completion)
+{
+	if (Ring != NULL && Overflowed_completions.size() == 0 && Ring->tail - Ring->head < Ring->capacity) {
+		Ring->entries[Ring->tail & (Ring->capacity - 1)] = completion;
+		Ring->tail++;
+	} else {
+		Overflowed_completions.push_back(completion);
+	}
+}
+
+void mqsim_instance::Flush_overflowed_completions()
+{
+	if (Ring == NULL) {
+		return;
+	}
+	while (Overflowed_completions.size() > 0 && Ring->tail - Ring->head < Ring->capacity) {
+		Ring->entries[Ring->tail & (Ring->capacity - 1)] = Overflowed_completions.front();
+		Ring->tail++;
+		Overflowed_completions.pop_front();
+	}
+}
+
+SSD_Components::User_Request* mqsim_instance::Create_user_request(uint64_t tag, uint32_t type, uint32_t flags)
+{
+	SSD_Components::User_Request* request = new SSD_Components::User_Request;
+	request->Stream_id = 0;
+	request->Priority_class = IO_Flow_Priority_Class::Priority::HIGH;
+	request->STAT_InitiationTime = Simulator->Time();
+	request->local = (flags & MQSIM_OP_FLAG_CHANNEL_TRANSFER) == 0;
+	uint32_t inflight_op_id = Allocate_inflight_op(tag, type);
+	mqsim_instance* instance = this;
+	request->finish_callback = [instance, inflight_op_id]() { instance->Complete(inflight_op_id); };
+
+	return request;
+}
+
+bool mqsim_instance::Is_valid_physical_address(const mqsim_physical_address& address, uint32_t type, uint32_t flags)
+{
+	return address.channel < Exec_params.SSD_Device_Configuration.Flash_Channel_Count
+		&& address.chip < Exec_params.SSD_Device_Configuration.Chip_No_Per_Channel
+		&& address.die < Exec_params.SSD_Device_Configuration.Flash_Parameters.Die_No_Per_Chip
+		&& ((flags & MQSIM_OP_FLAG_MULTIPLANE) != 0 || address.plane < Exec_params.SSD_Device_Configuration.Flash_Parameters.Plane_No_Per_Die)
+		&& address.block < Exec_params.SSD_Device_Configuration.Flash_Parameters.Block_No_Per_Plane
+		&& (type == MQSIM_OP_ERASE || address.page < Exec_params.SSD_Device_Configuration.Flash_Parameters.Page_No_Per_Block);
+}
+
+bool mqsim_instance::Is_valid_logical_address(const mqsim_logical_address& address)
+{
+	return address.sectors > 0 && address.lba >= First_lba && address.lba <= Last_lba
+		&& address.sectors - 1 <= Last_lba - address.lba;
+}
+
+//Creates the user request of a physical operation and its transactions, which are submitted later by Submit_physical_transactions
+bool mqsim_instance::Create_physical_operation(uint64_t tag, uint32_t type, uint32_t flags, const mqsim_physical_address& address, uint32_t pages)
+{
+	if ((type != MQSIM_OP_READ && type != MQSIM_OP_PROGRAM && type != MQSIM_OP_ERASE) || !Is_valid_physical_address(address, type, flags)) {
+		return false;
+	}
+
+	if (pages == 0) {
+		pages = 1;
+	}
+	SSD_Components::User_Request* request = Create_user_request(tag, type, flags);
+	request->Type = type == MQSIM_OP_READ ? SSD_Components::UserRequestType::READ : SSD_Components::UserRequestType::WRITE;
+	request->Start_LBA = 0;//Not used by physical operations
+	request->SizeInSectors = type == MQSIM_OP_ERASE ? 0 : Sectors_per_page * pages;
+	request->Size_in_byte = type == MQSIM_OP_ERASE ? 0 : Page_capacity * pages;
+
+	NVM::FlashMemory::Physical_Page_Address transaction_address(address.channel, address.chip, address.die, address.plane, address.block,
+		type == MQSIM_OP_ERASE ? 0 : address.page);
+	unsigned int first_plane = address.plane, last_plane = address.plane;
+	if (flags & MQSIM_OP_FLAG_MULTIPLANE) {
+		first_plane = 0;
+		last_plane = Exec_params.SSD_Device_Configuration.Flash_Parameters.Plane_No_Per_Die - 1;
+	}
+	for (unsigned int plane = first_plane; plane <= last_plane; plane++) {
+		transaction_address.PlaneID = plane;
+		SSD_Components::NVM_Transaction_Flash* transaction;
+		switch (type) {
+			case MQSIM_OP_READ:
+				transaction = new SSD_Components::NVM_Transaction_Flash_RD(SSD_Components::Transaction_Source_Type::USERIO, 0,
+					request->Size_in_byte, 0, NO_PPA, request, IO_Flow_Priority_Class::Priority::HIGH, 0, ~0UL, CurrentTimeStamp);
+				break;
+			case MQSIM_OP_PROGRAM:
+				transaction = new SSD_Components::NVM_Transaction_Flash_WR(SSD_Components::Transaction_Source_Type::USERIO, 0,
+					request->Size_in_byte, 0, request, IO_Flow_Priority_Class::Priority::HIGH, 0, ~0UL, CurrentTimeStamp);
+				break;
+			default:
+				transaction = new SSD_Components::NVM_Transaction_Flash_ER(SSD_Components::Transaction_Source_Type::USERIO, 0, transaction_address);
+				transaction->UserIORequest = request;
+				transaction->Priority_class = IO_Flow_Priority_Class::Priority::HIGH;
+				break;
+		}
+		transaction->Address = transaction_address;
+		transaction->Physical_address_determined = true;
+		request->Transaction_list.push_back(transaction);
+		Physical_transactions.push_back(transaction);
+	}
+
+	return true;
+}
+
+//All physical operations of a call are submitted within one bracket, so that the TSU can merge them into multi-plane and die-interleaved commands
+void mqsim_instance::Submit_physical_transactions()
+{
+	if (Physical_transactions.size() == 0) {
+		return;
+	}
+
+	SSD_Components::TSU_Base* tsu = ((SSD_Components::FTL*)SSD->Firmware)->TSU;
+	tsu->Prepare_for_transaction_submit();
+	for (auto &transaction : Physical_transactions) {
+		tsu->Submit_transaction(transaction);
+	}
+	tsu->Schedule();
+	Physical_transactions.clear();
+}
+
+uint32_t mqsim_api_version(void)
+{
+	return MQSIM_API_VERSION;
+}
+
+mqsim_t* mqsim_create(const char* ssd_config_file_path, const char* workload_defs_file_path)
+{
+	if (thread_instance != NULL) {
+		return NULL;
+	}
+
+	Simulator->Reset();
+	mqsim_instance* sim = new mqsim_instance;
+	Execution_Parameter_Set* exec_params = &sim->Exec_params;
+	exec_params->Host_Configuration.IO_Flow_Definitions.clear();
+	if (!load_ssd_config(ssd_config_file_path, exec_params) || !load_workload_config(workload_defs_file_path, exec_params)
+		|| exec_params->SSD_Device_Configuration.HostInterface_Type != HostInterface_Types::NVME) {
+		delete_io_flow_definitions(exec_params);
+		delete sim;
+		return NULL;
+	}
+
+	Simulator->Set_event_queue_type(exec_params->Engine_Configuration.Event_Queue);
+	Simulator->Set_profiling(exec_params->Engine_Configuration.Enable_Event_Profiling);
+	Simulator->Set_speed_report_period(exec_params->Engine_Configuration.Speed_Report_Period);
+	Simulator->Set_budget(exec_params->Engine_Configuration.Wall_Clock_Budget, exec_params->Engine_Configuration.Event_Budget);
+
+	//The batch APIs create flash transactions at a very high rate, the standalone simulator keeps the default allocator
+	SSD_Components::NVM_Transaction_Flash::Enable_pooling(true);
+	sim->SSD = new SSD_Device(&exec_params->SSD_Device_Configuration, &exec_params->Host_Configuration.IO_Flow_Definitions);
+	sim->SSD->Set_preconditioning_checkpoint_directory(exec_params->Engine_Configuration.Checkpoint_Directory);
+	std::string workload_path(workload_defs_file_path);
+	exec_params->Host_Configuration.Input_file_path = workload_path.substr(0, workload_path.find_last_of("."));
+	sim->Host = new Host_System(&exec_params->Host_Configuration, exec_params->SSD_Device_Configuration.Enabled_Preconditioning, sim->SSD->Host_interface);
+	sim->Host->Attach_ssd_device(sim->SSD);
+	for (unsigned int channel_id = 0; channel_id < exec_params->SSD_Device_Configuration.Flash_Channel_Count; channel_id++) {
+		((SSD_Components::NVM_PHY_ONFI*)sim->SSD->PHY)->ConnectToChannelStatusChangeSignal(channel_id, handle_channel_status_change);
+	}
+	Simulator->get_ready();
+	Simulator->clear_dummy_event();//Drops the events of the host I/O flows, all requests come through mqsim_submit
+
+	sim->Page_capacity = exec_params->SSD_Device_Configuration.Flash_Parameters.Page_Capacity;
+	sim->Sectors_per_page = sim->Page_capacity / SECTOR_SIZE_IN_BYTE;
+	sim->First_lba = Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(0);
+	sim->Last_lba = Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(0);
+	sim->Ring = NULL;
+	sim->Free_inflight_op = NO_FREE_INFLIGHT_OP;
+	sim->Channel_events_enabled = false;
+	sim->Completion_count = 0;
+	sim->Channel_event_count = 0;
+	thread_instance = sim;
+
+	return sim;
+}
+
+void mqsim_destroy(mqsim_t* sim)
+{
+	if (sim == NULL) {
+		return;
+	}
+
+	delete sim->Host;
+	delete sim->SSD;
+	delete_io_flow_definitions(&sim->Exec_params);
+	Simulator->Reset();
+	SSD_Components::NVM_Transaction_Flash::Enable_pooling(false);
+	if (thread_instance == sim) {
+		thread_instance = NULL;
+	}
+	delete sim;
+}
+
+int mqsim_set_completion_ring(mqsim_t* sim, mqsim_completion_ring* ring)
+{
+	if (ring != NULL && (ring->capacity == 0 || (ring->capacity & (ring->capacity - 1)) != 0)) {
+		return -1;
+	}
+
+	sim->Ring = ring;
+	sim->Flush_overflowed_completions();
+
+	return 0;
+}
+
+uint32_t mqsim_submit(mqsim_t* sim, const mqsim_op* ops, uint32_t count)
+{
+	sim->Flush_overflowed_completions();
+
+	SSD_Components::Host_Interface_Base* host_interface = sim->SSD->Host_interface;
+	uint32_t accepted = 0;
+	for (; accepted < count; accepted++) {
+		const mqsim_op& op = ops[accepted];
+		if (op.type == MQSIM_OP_READ || op.type == MQSIM_OP_PROGRAM || op.type == MQSIM_OP_ERASE) {
+			if (!sim->Create_physical_operation(op.tag, op.type, op.flags, op.address.physical, op.pages)) {
+				break;
+			}
+		} else if (op.type == MQSIM_OP_LOGICAL_READ || op.type == MQSIM_OP_LOGICAL_WRITE) {
+			if (!sim->Is_valid_logical_address(op.address.logical)) {
+				break;
+			}
+			SSD_Components::User_Request* request = sim->Create_user_request(op.tag, op.type, op.flags);
+			request->Type = op.type == MQSIM_OP_LOGICAL_READ ? SSD_Components::UserRequestType::READ : SSD_Components::UserRequestType::WRITE;
+			request->Start_LBA = op.address.logical.lba;
+			request->SizeInSectors = op.address.logical.sectors;
+			request->Size_in_byte = op.address.logical.sectors * SECTOR_SIZE_IN_BYTE;
+			host_interface->segment_user_request(request);
+			host_interface->broadcast_user_request_arrival_signal(request);
+		} else {
+			break;
+		}
+	}
+
+	sim->Submit_physical_transactions();
+
+	return accepted;
+}
+
+uint32_t mqsim_submit_physical(mqsim_t* sim, uint32_t type, const mqsim_physical_address* addresses, uint32_t count,
+	uint64_t first_tag, uint32_t flags, uint32_t pages)
+{
+	sim->Flush_overflowed_completions();
+
+	uint32_t accepted = 0;
+	for (; accepted < count; accepted++) {
+		if (!sim->Create_physical_operation(first_tag + accepted, type, flags, addresses[accepted], pages)) {
+			break;
+		}
+	}
+	sim->Submit_physical_transactions();
+
+	return accepted;
+}
+
+uint64_t mqsim_advance_until(mqsim_t* sim, uint64_t time)
+{
+	sim->Flush_overflowed_completions();
+	return Simulator->Advance_until(time);
+}
+
+void mqsim_tick(mqsim_t* sim)
+{
+	sim->Flush_overflowed_completions();
+	Simulator->tick();
+}
+
+uint64_t mqsim_now(const mqsim_t* sim)
+{
+	return Simulator->Time();
+}
+
+uint64_t mqsim_next_event_time(const mqsim_t* sim)
+{
+	return Simulator->get_next_event_firetime();
+}
+
+int mqsim_is_idle(const mqsim_t* sim)
+{
+	return Simulator->is_event_tree_empty() ? 1 : 0;
+}
+
+uint32_t mqsim_pending_completions(const mqsim_t* sim)
+{
+	return (uint32_t)sim->Overflowed_completions.size();
+}
+
+void mqsim_enable_channel_events(mqsim_t* sim, int enabled)
+{
+	sim->Channel_events_enabled = enabled != 0;
+}
+
+//The next host-visible event cannot happen before the next pending event of the engine, since only the execution of an event
+//(e.g., the end of a flash command) leads to a completion, which is reported through the completion path of Host_Interface_NVMe
+void mqsim_run_quantum(mqsim_t* sim, uint64_t bound, uint32_t flags, mqsim_quantum_result* result)
+{
+	sim->Flush_overflowed_completions();
+
+	uint64_t completion_count = sim->Completion_count;
+	uint64_t channel_event_count = sim->Channel_event_count;
+	if (flags & MQSIM_QUANTUM_STOP_AT_HOST_EVENT) {
+		sim_time_type next_event_time;
+		while ((next_event_time = Simulator->get_next_event_firetime()) != 0 && next_event_time <= bound) {
+			Simulator->Advance_until(next_event_time);
+			if (sim->Completion_count != completion_count || sim->Channel_event_count != channel_event_count) {
+				break;
+			}
+		}
+		if (sim->Completion_count == completion_count && sim->Channel_event_count == channel_event_count) {
+			Simulator->Advance_until(bound);
+		}
+	} else {
+		Simulator->Advance_until(bound);
+	}
+
+	if (result != NULL) {
+		result->reached_time = Simulator->Time();
+		result->next_event_time = Simulator->get_next_event_firetime();
+		result->completions = (uint32_t)(sim->Completion_count - completion_count);
+		result->channel_events = (uint32_t)(sim->Channel_event_count - channel_event_count);
+	}
+}
@@ -0,0 +1,197 @@
+#ifndef MQSIM_H
+#define MQSIM_H
+
+/*
+* C interface of libmqsim, which embeds an MQSim SSD model into another simulator.
+* The caller submits arrays of operations and receives their completions through a completion
+* ring that it allocates itself, so that no memory is allocated on the caller side per operation.
+* The simulation engine of MQSim is a per-thread singleton, hence at most one instance can exist
+* per thread, and all calls on an instance must be made from the thread that created it.
+*/
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+#if defined(MQSIM_BUILDING_LIBRARY)
+#define MQSIM_EXPORT __declspec(dllexport)
+#else
+#define MQSIM_EXPORT __declspec(dllimport)
+#endif
+#else
+#define MQSIM_EXPORT __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MQSIM_API_VERSION 1
+
+typedef struct mqsim_instance mqsim_t;
+
+typedef enum mqsim_op_type
+{
+	MQSIM_OP_READ = 0,//Physical page read, the address is given in address.physical
+	MQSIM_OP_PROGRAM = 1,//Physical page program, the address is given in address.physical
+	MQSIM_OP_LOGICAL_READ = 2,//Read through the FTL, the address is given in address.logical
+	MQSIM_OP_LOGICAL_WRITE = 3,//Write through the FTL, the address is given in address.logical
+	MQSIM_OP_ERASE = 4//Physical block erase, the address is given in address.physical and its page is ignored
+} mqsim_op_type;
+
+#define MQSIM_OP_FLAG_CHANNEL_TRANSFER 0x1u//Physical operations: transfer the page data over the flash channel, otherwise the data stays on the chip
+#define MQSIM_OP_FLAG_MULTIPLANE 0x2u//Physical operations: apply the operation to the same block and page of all planes of the die (the plane is ignored), the operation completes once all planes are done
+
+typedef enum mqsim_status
+{
+	MQSIM_STATUS_OK = 0,
+	MQSIM_STATUS_REJECTED = 1//Co-simulation mode: the operation has an invalid type or address and was not executed
+} mqsim_status;
+
+typedef struct mqsim_physical_address
+{
+	uint32_t channel;
+	uint32_t chip;
+	uint32_t die;
+	uint32_t plane;
+	uint32_t block;
+	uint32_t page;
+} mqsim_physical_address;
+
+typedef struct mqsim_logical_address
+{
+	uint64_t lba;//in sectors
+	uint32_t sectors;//At least one, and lba + sectors must not exceed the logical capacity of the device
+	uint32_t reserved;
+} mqsim_logical_address;
+
+typedef struct mqsim_op
+{
+	uint64_t tag;//Returned unchanged in the completion of the operation
+	uint32_t type;//One of mqsim_op_type
+	uint32_t flags;
+	union
+	{
+		mqsim_physical_address physical;
+		mqsim_logical_address logical;
+	} address;
+	uint32_t pages;//Physical operations: the amount of transferred data in pages, 0 is treated as 1
+	uint32_t reserved;
+} mqsim_op;
+
+typedef struct mqsim_completion
+{
+	uint64_t tag;
+	uint64_t submit_time;//in nanoseconds of simulation time
+	uint64_t complete_time;//in nanoseconds of simulation time
+	uint32_t type;//One of mqsim_op_type, or one of the MQSIM_EVENT_* types
+	uint32_t status;//One of mqsim_status
+} mqsim_completion;
+
+//Once enabled with mqsim_enable_channel_events, the status changes of the flash channels are reported in the completion
+//ring as entries of these types, whose tag is the channel ID and whose submit_time and complete_time are the time of the change
+#define MQSIM_EVENT_CHANNEL_BUSY 0x100u
+#define MQSIM_EVENT_CHANNEL_IDLE 0x101u
+
+/*
+* A single-producer/single-consumer ring of completions. MQSim writes entries[tail % capacity] and
+* increments tail; the caller reads entries[head % capacity] and increments head. Completions that
+* do not fit into a full ring are kept by MQSim and appended once the caller has made room.
+*/
+typedef struct mqsim_completion_ring
+{
+	mqsim_completion* entries;
+	uint32_t capacity;//Must be a power of two
+	uint32_t reserved;
+	uint64_t head;
+	uint64_t tail;
+} mqsim_completion_ring;
+
+MQSIM_EXPORT uint32_t mqsim_api_version(void);
+
+//Returns NULL if the configuration files cannot be read or another instance exists on the calling thread
+MQSIM_EXPORT mqsim_t* mqsim_create(const char* ssd_config_file_path, const char* workload_defs_file_path);
+MQSIM_EXPORT void mqsim_destroy(mqsim_t* sim);
+
+//Returns 0 on success, or -1 if the capacity of the ring is not a power of two
+MQSIM_EXPORT int mqsim_set_completion_ring(mqsim_t* sim, mqsim_completion_ring* ring);
+
+//Submits the operations at the current simulation time and returns the number of accepted operations.
+//Submission stops at the first operation with an invalid type or address.
+MQSIM_EXPORT uint32_t mqsim_submit(mqsim_t* sim, const mqsim_op* ops, uint32_t count);
+
+//Submits one physical operation of the given type (MQSIM_OP_READ, MQSIM_OP_PROGRAM, or MQSIM_OP_ERASE) per address, where the
+//operation on addresses[i] is tagged with first_tag + i. Returns the number of accepted operations like mqsim_submit.
+MQSIM_EXPORT uint32_t mqsim_submit_physical(mqsim_t* sim, uint32_t type, const mqsim_physical_address* addresses, uint32_t count,
+	uint64_t first_tag, uint32_t flags, uint32_t pages);
+
+//Executes all events up to the given time, returns the fire time of the next pending event (0 if none)
+MQSIM_EXPORT uint64_t mqsim_advance_until(mqsim_t* sim, uint64_t time);
+MQSIM_EXPORT void mqsim_tick(mqsim_t* sim);//Advances the simulation time by one nanosecond
+MQSIM_EXPORT uint64_t mqsim_now(const mqsim_t* sim);
+MQSIM_EXPORT uint64_t mqsim_next_event_time(const mqsim_t* sim);//0 if there is no pending event
+MQSIM_EXPORT int mqsim_is_idle(const mqsim_t* sim);
+MQSIM_EXPORT uint32_t mqsim_pending_completions(const mqsim_t* sim);//Completions waiting for room in the ring
+MQSIM_EXPORT void mqsim_enable_channel_events(mqsim_t* sim, int enabled);
+
+/*
+* Quantum-based synchronization. The caller grants MQSim the permission to run up to a time bound
+* (e.g., T + quantum), and MQSim reports the earliest time at which it could next produce a host-visible
+* event, i.e., a completion or a reported channel status change. No such event can happen before that time
+* unless the caller submits new operations, so the caller can safely skip the idle periods up to it.
+*/
+#define MQSIM_QUANTUM_STOP_AT_HOST_EVENT 0x1u//Return at the time of the first host-visible event instead of running to the bound
+
+typedef struct mqsim_quantum_result
+{
+	uint64_t reached_time;//The simulation time at the end of the quantum
+	uint64_t next_event_time;//The earliest time of the next host-visible event, 0 if no event can happen before a new submission
+	uint32_t completions;//The number of completions produced during the quantum
+	uint32_t channel_events;//The number of channel status changes reported during the quantum
+} mqsim_quantum_result;
+
+//Runs the simulation up to the bound (see MQSIM_QUANTUM_STOP_AT_HOST_EVENT) and fills in result, which may be NULL
+MQSIM_EXPORT void mqsim_run_quantum(mqsim_t* sim, uint64_t bound, uint32_t flags, mqsim_quantum_result* result);
+
+/*
+* Threaded co-simulation mode. The MQSim instance lives on its own simulator thread, so that the caller's
+* simulator and MQSim overlap their work instead of alternating. The caller enqueues timestamped operations
+* into a lock-free submission ring and grants the simulator thread a time bound. The simulator thread
+* submits each operation at its timestamp, runs ahead up to the granted bound, and pushes completions into a
+* lock-free completion ring. Each of the two rings has a single producer and a single consumer, hence all
+* calls on a co-simulation instance must be made from one caller thread.
+* The results are identical to the single-threaded interface as long as every operation is enqueued before
+* a bound that covers its timestamp is granted.
+*/
+typedef struct mqsim_cosim_instance mqsim_cosim_t;
+
+typedef struct mqsim_timed_op
+{
+	uint64_t time;//The simulation time of the submission in nanoseconds, operations must be enqueued in nondecreasing time order
+	mqsim_op op;
+} mqsim_timed_op;
+
+//Both capacities must be powers of two. Returns NULL if the capacities are invalid or the instance cannot be created.
+MQSIM_EXPORT mqsim_cosim_t* mqsim_cosim_create(const char* ssd_config_file_path, const char* workload_defs_file_path,
+	uint32_t submission_capacity, uint32_t completion_capacity);
+MQSIM_EXPORT void mqsim_cosim_destroy(mqsim_cosim_t* cosim);
+//Enqueues the operations without blocking and returns the number of enqueued operations, which is smaller than count if the ring is full
+MQSIM_EXPORT uint32_t mqsim_cosim_submit(mqsim_cosim_t* cosim, const mqsim_timed_op* ops, uint32_t count);
+//Allows the simulator thread to run up to the given time, a bound smaller than a previously granted one is ignored
+MQSIM_EXPORT void mqsim_cosim_grant(mqsim_cosim_t* cosim, uint64_t time);
+//All events up to the returned time are executed and their completions are in the completion ring
+MQSIM_EXPORT uint64_t mqsim_cosim_reached_time(const mqsim_cosim_t* cosim);
+//The lookahead of the reached time: the earliest time of the next host-visible event, 0 if none can happen before a new submission
+MQSIM_EXPORT uint64_t mqsim_cosim_next_event_time(const mqsim_cosim_t* cosim);
+//Waits until the reached time is at least the given time, and returns the reached time. It returns earlier if the
+//completion ring is full, so that the caller can make room, or if the simulation has been stopped by a budget.
+MQSIM_EXPORT uint64_t mqsim_cosim_wait(mqsim_cosim_t* cosim, uint64_t time);
+//Takes effect before the next submission or time bound is processed by the simulator thread, see mqsim_enable_channel_events
+MQSIM_EXPORT void mqsim_cosim_enable_channel_events(mqsim_cosim_t* cosim, int enabled);
+//Moves up to max_count completions into the given array and returns their number
+MQSIM_EXPORT uint32_t mqsim_cosim_poll(mqsim_cosim_t* cosim, mqsim_completion* completions, uint32_t max_count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // !MQSIM_H
@@ -0,0 +1,189 @@
+#ifndef MQSIM_HPP
+#define MQSIM_HPP
+
+/*
+* Header-only C++ interface of libmqsim. It only wraps the C interface in mqsim.h, so that
+* programs built with a different compiler or standard library can link against the same library.
+*/
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "mqsim.h"
+
+namespace mqsim
+{
+	typedef mqsim_op Op;
+	typedef mqsim_completion Completion;
+	typedef mqsim_physical_address Physical_address;
+	typedef mqsim_quantum_result Quantum_result;
+
+	inline Op Physical_op(mqsim_op_type type, uint64_t tag, uint32_t channel, uint32_t chip, uint32_t die, uint32_t plane, uint32_t block, uint32_t page,
+		uint32_t pages = 1, uint32_t flags = 0)
+	{
+		Op op = {};
+		op.tag = tag;
+		op.type = type;
+		op.flags = flags;
+		op.address.physical.channel = channel;
+		op.address.physical.chip = chip;
+		op.address.physical.die = die;
+		op.address.physical.plane = plane;
+		op.address.physical.block = block;
+		op.address.physical.page = page;
+		op.pages = pages;
+		return op;
+	}
+
+	inline Op Logical_op(mqsim_op_type type, uint64_t tag, uint64_t lba, uint32_t sectors)
+	{
+		Op op = {};
+		op.tag = tag;
+		op.type = type;
+		op.address.logical.lba = lba;
+		op.address.logical.sectors = sectors;
+		return op;
+	}
+
+	class Completion_ring
+	{
+	public:
+		explicit Completion_ring(uint32_t capacity) : entries(capacity)
+		{
+			if (capacity == 0 || (capacity & (capacity - 1)) != 0) {
+				throw std::invalid_argument("The capacity of a completion ring must be a power of two");
+			}
+			ring.entries = entries.data();
+			ring.capacity = capacity;
+			ring.reserved = 0;
+			ring.head = 0;
+			ring.tail = 0;
+		}
+		Completion_ring(const Completion_ring&) = delete;
+		Completion_ring& operator=(const Completion_ring&) = delete;
+		bool Empty() const { return ring.head == ring.tail; }
+		uint64_t Size() const { return ring.tail - ring.head; }
+		bool Pop(Completion& completion)
+		{
+			if (ring.head == ring.tail) {
+				return false;
+			}
+			completion = ring.entries[ring.head & (ring.capacity - 1)];
+			ring.head++;
+			return true;
+		}
+		template <typename Handler>
+		uint64_t Drain(Handler handler)//Calls handler for each available completion and returns their number
+		{
+			uint64_t count = ring.tail - ring.head;
+			for (; ring.head != ring.tail; ring.head++) {
+				handler(ring.entries[ring.head & (ring.capacity - 1)]);
+			}
+			return count;
+		}
+		mqsim_completion_ring* Get() { return &ring; }
+	private:
+		std::vector<Completion> entries;
+		mqsim_completion_ring ring;
+	};
+
+	class Device
+	{
+	public:
+		Device(const std::string& ssd_config_file_path, const std::string& workload_defs_file_path)
+		{
+			handle = mqsim_create(ssd_config_file_path.c_str(), workload_defs_file_path.c_str());
+			if (handle == NULL) {
+				throw std::runtime_error("Unable to create an MQSim instance from " + ssd_config_file_path + " and " + workload_defs_file_path);
+			}
+		}
+		~Device() { mqsim_destroy(handle); }
+		Device(const Device&) = delete;
+		Device& operator=(const Device&) = delete;
+
+		void Set_completion_ring(Completion_ring& ring) { mqsim_set_completion_ring(handle, ring.Get()); }
+		uint32_t Submit(const Op* ops, uint32_t count) { return mqsim_submit(handle, ops, count); }
+		uint32_t Submit(const std::vector<Op>& ops) { return mqsim_submit(handle, ops.data(), (uint32_t)ops.size()); }
+		uint32_t Submit_physical(mqsim_op_type type, const Physical_address* addresses, uint32_t count, uint64_t first_tag, uint32_t flags = 0, uint32_t pages = 1)
+		{
+			return mqsim_submit_physical(handle, type, addresses, count, first_tag, flags, pages);
+		}
+		uint32_t Submit_physical(mqsim_op_type type, const std::vector<Physical_address>& addresses, uint64_t first_tag, uint32_t flags = 0, uint32_t pages = 1)
+		{
+			return mqsim_submit_physical(handle, type, addresses.data(), (uint32_t)addresses.size(), first_tag, flags, pages);
+		}
+		uint64_t Advance_until(uint64_t time) { return mqsim_advance_until(handle, time); }
+		void Tick() { mqsim_tick(handle); }
+		uint64_t Now() const { return mqsim_now(handle); }
+		uint64_t Next_event_time() const { return mqsim_next_event_time(handle); }
+		bool Is_idle() const { return mqsim_is_idle(handle) != 0; }
+		uint32_t Pending_completions() const { return mqsim_pending_completions(handle); }
+		void Enable_channel_events(bool enabled = true) { mqsim_enable_channel_events(handle, enabled ? 1 : 0); }
+		Quantum_result Run_quantum(uint64_t bound, bool stop_at_host_event = false)
+		{
+			Quantum_result result;
+			mqsim_run_quantum(handle, bound, stop_at_host_event ? MQSIM_QUANTUM_STOP_AT_HOST_EVENT : 0, &result);
+			return result;
+		}
+	private:
+		mqsim_t* handle;
+	};
+
+	typedef mqsim_timed_op Timed_op;
+
+	inline Timed_op Timed(uint64_t time, const Op& op)
+	{
+		Timed_op timed_op;
+		timed_op.time = time;
+		timed_op.op = op;
+		return timed_op;
+	}
+
+	//Runs the SSD model on its own thread, see mqsim_cosim_create
+	class Cosim_device
+	{
+	public:
+		Cosim_device(const std::string& ssd_config_file_path, const std::string& workload_defs_file_path,
+			uint32_t submission_capacity = 4096, uint32_t completion_capacity = 4096)
+		{
+			handle = mqsim_cosim_create(ssd_config_file_path.c_str(), workload_defs_file_path.c_str(), submission_capacity, completion_capacity);
+			if (handle == NULL) {
+				throw std::runtime_error("Unable to create an MQSim co-simulation instance from " + ssd_config_file_path + " and " + workload_defs_file_path);
+			}
+		}
+		~Cosim_device() { mqsim_cosim_destroy(handle); }
+		Cosim_device(const Cosim_device&) = delete;
+		Cosim_device& operator=(const Cosim_device&) = delete;
+
+		uint32_t Submit(const Timed_op* ops, uint32_t count) { return mqsim_cosim_submit(handle, ops, count); }
+		uint32_t Submit(const std::vector<Timed_op>& ops) { return mqsim_cosim_submit(handle, ops.data(), (uint32_t)ops.size()); }
+		bool Submit(uint64_t time, const Op& op)
+		{
+			Timed_op timed_op = Timed(time, op);
+			return mqsim_cosim_submit(handle, &timed_op, 1) == 1;
+		}
+		void Grant(uint64_t time) { mqsim_cosim_grant(handle, time); }
+		uint64_t Reached_time() const { return mqsim_cosim_reached_time(handle); }
+		uint64_t Next_event_time() const { return mqsim_cosim_next_event_time(handle); }
+		void Enable_channel_events(bool enabled = true) { mqsim_cosim_enable_channel_events(handle, enabled ? 1 : 0); }
+		uint64_t Wait(uint64_t time) { return mqsim_cosim_wait(handle, time); }
+		template <typename Handler>
+		uint32_t Drain(Handler handler)//Calls handler for each available completion and returns their number
+		{
+			Completion completions[64];
+			uint32_t total = 0, count;
+			while ((count = mqsim_cosim_poll(handle, completions, 64)) > 0) {
+				for (uint32_t i = 0; i < count; i++) {
+					handler(completions[i]);
+				}
+				total += count;
+			}
+			return total;
+		}
+	private:
+		mqsim_cosim_t* handle;
+	};
+}
+
+#endif // !MQSIM_HPP
@@ -0,0 +1,288 @@
+#include <atomic>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+#include "mqsim.h"
+#include "../utils/Spsc_Ring.h"
+#include "../utils/Thread_Waiter.h"
+
+#define COSIM_LOCAL_RING_CAPACITY 1024
+
+enum class Cosim_State { STARTING, RUNNING, FAILED, STOPPED };
+
+struct mqsim_cosim_instance
+{
+	mqsim_cosim_instance(uint32_t submission_capacity, uint32_t completion_capacity) :
+		Submissions(submission_capacity), Completions(completion_capacity),
+		State(Cosim_State::STARTING), Granted_time(0), Reached_time(0), Next_event_time(0), Channel_events_enabled(false), Stalled(false), Stop_requested(false) {}
+
+	Utils::Spsc_Ring<mqsim_timed_op> Submissions;//Caller thread -> simulator thread
+	Utils::Spsc_Ring<mqsim_completion> Completions;//Simulator thread -> caller thread
+	std::atomic<Cosim_State> State;
+	std::atomic<uint64_t> Granted_time;
+	std::atomic<uint64_t> Reached_time;
+	std::atomic<uint64_t> Next_event_time;//The lookahead of Reached_time, published before it
+	std::atomic<bool> Channel_events_enabled;
+	std::atomic<bool> Stalled;//The completion ring is full and the simulator thread waits for the caller to make room
+	std::atomic<bool> Stop_requested;
+	Utils::Thread_Waiter Simulator_wakeup;//Submissions, grants, polls and the stop request wake up the simulator thread
+	Utils::Thread_Waiter Caller_wakeup;//State, reached time and stall changes wake up the caller thread
+	std::thread Simulator_thread;
+};
+
+static bool is_power_of_two(uint32_t value)
+{
+	return value != 0 && (value & (value - 1)) == 0;
+}
+
+//The state of the simulator thread, only accessed by that thread
+class Cosim_Runner
+{
+public:
+	Cosim_Runner(mqsim_cosim_instance* cosim, mqsim_t* sim) : cosim(cosim), sim(sim), local_entries(COSIM_LOCAL_RING_CAPACITY)
+	{
+		local_ring.entries = local_entries.data();
+		local_ring.capacity = COSIM_LOCAL_RING_CAPACITY;
+		local_ring.reserved = 0;
+		local_ring.head = 0;
+		local_ring.tail = 0;
+		mqsim_set_completion_ring(sim, &local_ring);
+	}
+
+	void Run()
+	{
+		while (!cosim->Stop_requested.load(std::memory_order_acquire)) {
+			//The simulation does not run ahead while the caller has not consumed the completions that are produced so far
+			if (!forward_completions()) {
+				cosim->Stalled.store(true, std::memory_order_release);
+				cosim->Caller_wakeup.Notify();
+				wait_for_room();
+				continue;
+			}
+			cosim->Stalled.store(false, std::memory_order_release);
+
+			uint64_t bound = cosim->Granted_time.load(std::memory_order_acquire);
+			mqsim_enable_channel_events(sim, cosim->Channel_events_enabled.load(std::memory_order_relaxed) ? 1 : 0);
+			const mqsim_timed_op* next = cosim->Submissions.Front();
+			uint64_t target_time = next != NULL && next->time < bound ? next->time : bound;
+			bool progressed = false;
+			if (mqsim_now(sim) < target_time) {
+				mqsim_advance_until(sim, target_time);
+				if (mqsim_now(sim) < target_time) {
+					//The engine stops moving the time once it is stopped by a budget
+					stop();
+					return;
+				}
+				progressed = true;
+			}
+			if (next != NULL && next->time <= bound) {
+				submit_due_operations();
+				progressed = true;
+			}
+			if (forward_completions()) {
+				publish_reached_time();
+			}
+			if (!progressed) {
+				//Only a later bound, a due submission or the stop request let the simulation move on
+				cosim->Simulator_wakeup.Wait([this, bound]() {
+					const mqsim_timed_op* next = cosim->Submissions.Front();
+					return outgoing.size() > 0 || cosim->Stop_requested.load(std::memory_order_acquire)
+						|| cosim->Granted_time.load(std::memory_order_acquire) > bound || (next != NULL && next->time <= bound);
+				});
+			}
+		}
+	}
+private:
+	mqsim_cosim_instance* cosim;
+	mqsim_t* sim;
+	std::vector<mqsim_completion> local_entries;
+	mqsim_completion_ring local_ring;
+	std::deque<mqsim_completion> outgoing;//Completions that did not fit into the completion ring of the caller
+	std::vector<mqsim_op> batch;
+
+	void publish_reached_time()
+	{
+		cosim->Next_event_time.store(mqsim_next_event_time(sim), std::memory_order_relaxed);
+		cosim->Reached_time.store(mqsim_now(sim), std::memory_order_release);
+		cosim->Caller_wakeup.Notify();
+	}
+
+	//Waits until the caller polls enough completions to forward all of the pending ones, or requests the stop
+	void wait_for_room()
+	{
+		cosim->Simulator_wakeup.Wait([this]() {
+			return forward_completions() || cosim->Stop_requested.load(std::memory_order_acquire);
+		});
+	}
+
+	//The completions that are produced before the stop are still delivered
+	void stop()
+	{
+		if (!forward_completions()) {
+			cosim->Stalled.store(true, std::memory_order_release);
+			cosim->Caller_wakeup.Notify();
+			wait_for_room();
+		}
+		publish_reached_time();
+		cosim->State.store(Cosim_State::STOPPED, std::memory_order_release);
+		cosim->Caller_wakeup.Notify();
+		cosim->Simulator_wakeup.Wait([this]() {
+			return cosim->Stop_requested.load(std::memory_order_acquire);
+		});
+	}
+
+	//All operations of the current time are submitted together, so that the TSU can merge them into multi-plane commands
+	void submit_due_operations()
+	{
+		batch.clear();
+		const mqsim_timed_op* next;
+		while ((next = cosim->Submissions.Front()) != NULL && next->time <= mqsim_now(sim)) {
+			batch.push_back(next->op);
+			cosim->Submissions.Pop_front();
+		}
+
+		uint32_t submitted = 0;
+		while (submitted < batch.size()) {
+			submitted += mqsim_submit(sim, &batch[submitted], (uint32_t)batch.size() - submitted);
+			if (submitted < batch.size()) {
+				mqsim_completion completion;
+				completion.tag = batch[submitted].tag;
+				completion.submit_time = mqsim_now(sim);
+				completion.complete_time = mqsim_now(sim);
+				completion.type = batch[submitted].type;
+				completion.status = MQSIM_STATUS_REJECTED;
+				outgoing.push_back(completion);
+				submitted++;
+			}
+		}
+	}
+
+	//Returns true if all the completions produced so far are in the completion ring of the caller
+	bool forward_completions()
+	{
+		for (; local_ring.head != local_ring.tail; local_ring.head++) {
+			outgoing.push_back(local_ring.entries[local_ring.head & (local_ring.capacity - 1)]);
+		}
+		if (mqsim_pending_completions(sim) > 0) {
+			mqsim_set_completion_ring(sim, &local_ring);//Moves the completions that are waiting for room into the local ring
+			return forward_completions();
+		}
+		while (outgoing.size() > 0 && cosim->Completions.Push(outgoing.front())) {
+			outgoing.pop_front();
+		}
+
+		return outgoing.size() == 0;
+	}
+};
+
+static void run_simulator_thread(mqsim_cosim_instance* cosim, std::string ssd_config_file_path, std::string workload_defs_file_path)
+{
+	mqsim_t* sim = mqsim_create(ssd_config_file_path.c_str(), workload_defs_file_path.c_str());
+	if (sim == NULL) {
+		cosim->State.store(Cosim_State::FAILED, std::memory_order_release);
+		cosim->Caller_wakeup.Notify();
+		return;
+	}
+	cosim->Reached_time.store(mqsim_now(sim), std::memory_order_release);
+	cosim->Granted_time.store(mqsim_now(sim), std::memory_order_release);
+	cosim->State.store(Cosim_State::RUNNING, std::memory_order_release);
+	cosim->Caller_wakeup.Notify();
+
+	Cosim_Runner runner(cosim, sim);
+	runner.Run();
+	mqsim_destroy(sim);
+}
+
+mqsim_cosim_t* mqsim_cosim_create(const char* ssd_config_file_path, const char* workload_defs_file_path,
+	uint32_t submission_capacity, uint32_t completion_capacity)
+{
+	if (!is_power_of_two(submission_capacity) || !is_power_of_two(completion_capacity)) {
+		return NULL;
+	}
+
+	mqsim_cosim_instance* cosim = new mqsim_cosim_instance(submission_capacity, completion_capacity);
+	cosim->Simulator_thread = std::thread(run_simulator_thread, cosim, std::string(ssd_config_file_path), std::string(workload_defs_file_path));
+	//Creating the simulator can take long, hence the caller thread blocks instead of spinning
+	cosim->Caller_wakeup.Wait([cosim]() {
+		return cosim->State.load(std::memory_order_acquire) != Cosim_State::STARTING;
+	});
+	if (cosim->State.load(std::memory_order_acquire) == Cosim_State::FAILED) {
+		cosim->Simulator_thread.join();
+		delete cosim;
+		return NULL;
+	}
+
+	return cosim;
+}
+
+void mqsim_cosim_destroy(mqsim_cosim_t* cosim)
+{
+	if (cosim == NULL) {
+		return;
+	}
+
+	cosim->Stop_requested.store(true, std::memory_order_release);
+	cosim->Simulator_wakeup.Notify();
+	cosim->Simulator_thread.join();
+	delete cosim;
+}
+
+uint32_t mqsim_cosim_submit(mqsim_cosim_t* cosim, const mqsim_timed_op* ops, uint32_t count)
+{
+	uint32_t enqueued = 0;
+	while (enqueued < count && cosim->Submissions.Push(ops[enqueued])) {
+		enqueued++;
+	}
+	if (enqueued > 0) {
+		cosim->Simulator_wakeup.Notify();
+	}
+
+	return enqueued;
+}
+
+void mqsim_cosim_grant(mqsim_cosim_t* cosim, uint64_t time)
+{
+	if (time > cosim->Granted_time.load(std::memory_order_relaxed)) {
+		cosim->Granted_time.store(time, std::memory_order_release);
+		cosim->Simulator_wakeup.Notify();
+	}
+}
+
+uint64_t mqsim_cosim_reached_time(const mqsim_cosim_t* cosim)
+{
+	return cosim->Reached_time.load(std::memory_order_acquire);
+}
+
+uint64_t mqsim_cosim_next_event_time(const mqsim_cosim_t* cosim)
+{
+	return cosim->Next_event_time.load(std::memory_order_relaxed);
+}
+
+void mqsim_cosim_enable_channel_events(mqsim_cosim_t* cosim, int enabled)
+{
+	cosim->Channel_events_enabled.store(enabled != 0, std::memory_order_relaxed);
+}
+
+uint64_t mqsim_cosim_wait(mqsim_cosim_t* cosim, uint64_t time)
+{
+	cosim->Caller_wakeup.Wait([cosim, time]() {
+		return cosim->Reached_time.load(std::memory_order_acquire) >= time || cosim->Stalled.load(std::memory_order_acquire)
+			|| cosim->State.load(std::memory_order_acquire) != Cosim_State::RUNNING;
+	});
+
+	return cosim->Reached_time.load(std::memory_order_acquire);
+}
+
+uint32_t mqsim_cosim_poll(mqsim_cosim_t* cosim, mqsim_completion* completions, uint32_t max_count)
+{
+	uint32_t count = 0;
+	while (count < max_count && cosim->Completions.Pop(completions[count])) {
+		count++;
+	}
+	if (count > 0) {
+		cosim->Simulator_wakeup.Notify();
+	}
+
+	return count;
+}
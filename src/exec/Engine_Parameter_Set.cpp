@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cstring>
+#include "Engine_Parameter_Set.h"
+
+
+thread_local MQSimEngine::Event_Queue_Type Engine_Parameter_Set::Event_Queue = MQSimEngine::Event_Queue_Type::RED_BLACK_TREE;//The data structure that holds the pending simulation events
+thread_local bool Engine_Parameter_Set::Enable_Event_Profiling = false;//Record the event counts and the wall-clock time of the event handlers per simulation object
+thread_local double Engine_Parameter_Set::Speed_Report_Period = 0;//The wall-clock period of the simulation speed reports in seconds, 0 disables the reports
+thread_local double Engine_Parameter_Set::Wall_Clock_Budget = 0;//The simulation is stopped after this many wall-clock seconds, 0 means unlimited
+thread_local unsigned long long Engine_Parameter_Set::Event_Budget = 0;//The simulation is stopped after this many executed events, 0 means unlimited
+thread_local std::string Engine_Parameter_Set::Checkpoint_Directory = "";//The directory of the preconditioning checkpoints, an empty string disables checkpointing
+
+void Engine_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
+{
+	std::string tmp;
+	tmp = "Engine_Parameter_Set";
+	xmlwriter.Write_open_tag(tmp);
+
+	std::string attr = "Event_Queue";
+	std::string val;
+	switch (Event_Queue) {
+		case MQSimEngine::Event_Queue_Type::RED_BLACK_TREE:
+			val = "RED_BLACK_TREE";
+			break;
+		case MQSimEngine::Event_Queue_Type::CALENDAR_QUEUE:
+			val = "CALENDAR_QUEUE";
+			break;
+		default:
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Enable_Event_Profiling";
+	val = (Enable_Event_Profiling ? "true" : "false");
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Speed_Report_Period";
+	val = std::to_string(Speed_Report_Period);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Wall_Clock_Budget";
+	val = std::to_string(Wall_Clock_Budget);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Event_Budget";
+	val = std::to_string(Event_Budget);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Checkpoint_Directory";
+	val = Checkpoint_Directory;
+	xmlwriter.Write_attribute_string(attr, val);
+
+	xmlwriter.Write_close_tag();
+}
+
+void Engine_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
+{
+	try {
+		for (auto param = node->first_node(); param; param = param->next_sibling()) {
+			if (strcmp(param->name(), "Event_Queue") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "RED_BLACK_TREE") == 0) {
+					Event_Queue = MQSimEngine::Event_Queue_Type::RED_BLACK_TREE;
+				} else if (strcmp(val.c_str(), "CALENDAR_QUEUE") == 0) {
+					Event_Queue = MQSimEngine::Event_Queue_Type::CALENDAR_QUEUE;
+				} else {
+					PRINT_ERROR("Unknown event queue type specified in the SSD configuration file")
+				}
+			} else if (strcmp(param->name(), "Enable_Event_Profiling") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				Enable_Event_Profiling = (val.compare("FALSE") == 0 ? false : true);
+			} else if (strcmp(param->name(), "Speed_Report_Period") == 0) {
+				std::string val = param->value();
+				Speed_Report_Period = std::stod(val);
+			} else if (strcmp(param->name(), "Wall_Clock_Budget") == 0) {
+				std::string val = param->value();
+				Wall_Clock_Budget = std::stod(val);
+			} else if (strcmp(param->name(), "Event_Budget") == 0) {
+				std::string val = param->value();
+				Event_Budget = std::stoull(val);
+			} else if (strcmp(param->name(), "Checkpoint_Directory") == 0) {
+				Checkpoint_Directory = param->value();
+			}
+		}
+	} catch (...) {
+		PRINT_ERROR("Error in the Engine_Parameter_Set!")
+	}
+}
@@ -0,0 +1,22 @@
+#ifndef ENGINE_PARAMETER_SET_H
+#define ENGINE_PARAMETER_SET_H
+
+#include <string>
+#include "../sim/EventQueue.h"
+#include "Parameter_Set_Base.h"
+
+class Engine_Parameter_Set : public Parameter_Set_Base
+{
+public:
+	static thread_local MQSimEngine::Event_Queue_Type Event_Queue;//The data structure that holds the pending simulation events
+	static thread_local bool Enable_Event_Profiling;//Record the event counts and the wall-clock time of the event handlers per simulation object
+	static thread_local double Speed_Report_Period;//The wall-clock period of the simulation speed reports in seconds, 0 disables the reports
+	static thread_local double Wall_Clock_Budget;//The simulation is stopped after this many wall-clock seconds, 0 means unlimited
+	static thread_local unsigned long long Event_Budget;//The simulation is stopped after this many executed events, 0 means unlimited
+	static thread_local std::string Checkpoint_Directory;//The directory of the preconditioning checkpoints, an empty string disables checkpointing
+
+	void XML_serialize(Utils::XmlWriter& xmlwriter);
+	void XML_deserialize(rapidxml::xml_node<> *node);
+};
+
+#endif // !ENGINE_PARAMETER_SET_H
@@ -1,8 +1,9 @@
 #include "Execution_Parameter_Set.h"
 
 
-Host_Parameter_Set Execution_Parameter_Set::Host_Configuration;
-Device_Parameter_Set Execution_Parameter_Set::SSD_Device_Configuration;
+thread_local Host_Parameter_Set Execution_Parameter_Set::Host_Configuration;
+thread_local Device_Parameter_Set Execution_Parameter_Set::SSD_Device_Configuration;
+thread_local Engine_Parameter_Set Execution_Parameter_Set::Engine_Configuration;
 
 
 void Execution_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
@@ -13,6 +14,7 @@ void Execution_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 
 	Host_Configuration.XML_serialize(xmlwriter);
 	SSD_Device_Configuration.XML_serialize(xmlwriter);
+	Engine_Configuration.XML_serialize(xmlwriter);
 
 	xmlwriter.Write_close_tag();
 }
@@ -25,6 +27,8 @@ void Execution_Parameter_Set::XML_deserialize(rapidxml::xml_node<> *node)
 				Host_Configuration.XML_deserialize(param);
 			} else if (strcmp(param->name(), "Device_Parameter_Set") == 0) {
 				SSD_Device_Configuration.XML_deserialize(param);
+			} else if (strcmp(param->name(), "Engine_Parameter_Set") == 0) {
+				Engine_Configuration.XML_deserialize(param);
 			}
 		}
 	} catch (...) {
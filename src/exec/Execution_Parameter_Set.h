@@ -6,12 +6,14 @@
 #include "Device_Parameter_Set.h"
 #include "IO_Flow_Parameter_Set.h"
 #include "Host_Parameter_Set.h"
+#include "Engine_Parameter_Set.h"
 
 class Execution_Parameter_Set : public Parameter_Set_Base
 {
 public:
-	static Host_Parameter_Set Host_Configuration;
-	static Device_Parameter_Set SSD_Device_Configuration;
+	static thread_local Host_Parameter_Set Host_Configuration;
+	static thread_local Device_Parameter_Set SSD_Device_Configuration;
+	static thread_local Engine_Parameter_Set Engine_Configuration;
 
 	void XML_serialize(Utils::XmlWriter& xmlwriter);
 	void XML_deserialize(rapidxml::xml_node<> *node);
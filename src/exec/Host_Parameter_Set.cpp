@@ -2,13 +2,13 @@
 #include "Host_Parameter_Set.h"
 
 
-double Host_Parameter_Set::PCIe_Lane_Bandwidth = 0.4;//uint is GB/s
-unsigned int Host_Parameter_Set::PCIe_Lane_Count = 4;
-sim_time_type Host_Parameter_Set::SATA_Processing_Delay;//The overall hardware and software processing delay to send/receive a SATA message in nanoseconds
-bool Host_Parameter_Set::Enable_ResponseTime_Logging = false;
-sim_time_type Host_Parameter_Set::ResponseTime_Logging_Period_Length = 400000;//nanoseconds
-std::string Host_Parameter_Set::Input_file_path;
-std::vector<IO_Flow_Parameter_Set*> Host_Parameter_Set::IO_Flow_Definitions;
+thread_local double Host_Parameter_Set::PCIe_Lane_Bandwidth = 0.4;//uint is GB/s
+thread_local unsigned int Host_Parameter_Set::PCIe_Lane_Count = 4;
+thread_local sim_time_type Host_Parameter_Set::SATA_Processing_Delay;//The overall hardware and software processing delay to send/receive a SATA message in nanoseconds
+thread_local bool Host_Parameter_Set::Enable_ResponseTime_Logging = false;
+thread_local sim_time_type Host_Parameter_Set::ResponseTime_Logging_Period_Length = 400000;//nanoseconds
+thread_local std::string Host_Parameter_Set::Input_file_path;
+thread_local std::vector<IO_Flow_Parameter_Set*> Host_Parameter_Set::IO_Flow_Definitions;
 
 void Host_Parameter_Set::XML_serialize(Utils::XmlWriter& xmlwriter)
 {
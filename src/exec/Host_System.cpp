@@ -48,11 +48,17 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 				if (flow_param->Working_Set_Percentage > 100 || flow_param->Working_Set_Percentage < 1) {
 					flow_param->Working_Set_Percentage = 100;
 				}
+				std::vector<double> tier_address_ratios, tier_traffic_ratios;
+				for (size_t tier = 0; tier < flow_param->Tier_Address_Percentages.size(); tier++) {
+					tier_address_ratios.push_back(flow_param->Tier_Address_Percentages[tier] / double(100.0));
+					tier_traffic_ratios.push_back(flow_param->Tier_Traffic_Percentages[tier] / double(100.0));
+				}
 				io_flow = new Host_Components::IO_Flow_Synthetic(this->ID() + ".IO_Flow.Synth.No_" + std::to_string(flow_id), flow_id,
 					Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(flow_id),
 					Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(flow_id),
 					((double)flow_param->Working_Set_Percentage / 100.0), FLOW_ID_TO_Q_ID(flow_id), nvme_sq_size, nvme_cq_size,
 					flow_param->Priority_Class, flow_param->Read_Percentage / double(100.0), flow_param->Address_Distribution, flow_param->Percentage_of_Hot_Region / double(100.0),
+					flow_param->Zipfian_Exponent, tier_address_ratios, tier_traffic_ratios,
 					flow_param->Request_Size_Distribution, flow_param->Average_Request_Size, flow_param->Variance_Request_Size,
 					flow_param->Synthetic_Generator_Type, (flow_param->Bandwidth == 0? 0 :NanoSecondCoeff / ((flow_param->Bandwidth / SECTOR_SIZE_IN_BYTE) / flow_param->Average_Request_Size)),
 					flow_param->Average_No_of_Reqs_in_Queue, flow_param->Generated_Aligned_Addresses, flow_param->Address_Alignment_Unit,
@@ -63,11 +69,18 @@ Host_System::Host_System(Host_Parameter_Set* parameters, bool preconditioning_re
 			}
 			case Flow_Type::TRACE: {
 				IO_Flow_Parameter_Set_Trace_Based * flow_param = (IO_Flow_Parameter_Set_Trace_Based*)parameters->IO_Flow_Definitions[flow_id];
+				Host_Components::Trace_Sampling_Parameters sampling_parameters;
+				sampling_parameters.Load_scaling_factor = flow_param->Load_Scaling_Factor;
+				sampling_parameters.Window_start = flow_param->Time_Window_Start;
+				sampling_parameters.Window_end = flow_param->Time_Window_End;
+				sampling_parameters.Sampling_period = flow_param->Sampling_Period;
+				sampling_parameters.Sampling_length = flow_param->Sampling_Length;
 				io_flow = new Host_Components::IO_Flow_Trace_Based(this->ID() + ".IO_Flow.Trace." + flow_param->File_Path, flow_id,
 					Utils::Logical_Address_Partitioning_Unit::Start_lha_available_to_flow(flow_id), Utils::Logical_Address_Partitioning_Unit::End_lha_available_to_flow(flow_id),
 					FLOW_ID_TO_Q_ID(flow_id), nvme_sq_size, nvme_cq_size,
 					flow_param->Priority_Class, flow_param->Initial_Occupancy_Percentage / double(100.0),
-					flow_param->File_Path, flow_param->Time_Unit, flow_param->Relay_Count, flow_param->Percentage_To_Be_Executed,
+					flow_param->File_Path, flow_param->File_Format, flow_param->Time_Unit, flow_param->Relay_Count, flow_param->Percentage_To_Be_Executed,
+					sampling_parameters, flow_param->Replay_Mode, flow_param->Queue_Depth, flow_param->Think_Time,
 					ssd_host_interface->GetType(), this->PCIe_root_complex, this->SATA_hba,
 					parameters->Enable_ResponseTime_Logging, parameters->ResponseTime_Logging_Period_Length, parameters->Input_file_path + ".IO_Flow.No_" + std::to_string(flow_id) + ".log");
 
@@ -129,12 +142,19 @@ void Host_System::Start_simulation()
 			break;
 	}
 
-	if (preconditioning_required) {
+	Precondition_ssd_device();
+}
+
+void Host_System::Precondition_ssd_device()
+{
+	//Gathering the workload statistics and preconditioning are skipped if an earlier run left a checkpoint of the preconditioned state
+	if (preconditioning_required && !ssd_device->Load_preconditioning_checkpoint()) {
 		std::vector<Utils::Workload_Statistics*> workload_stats = get_workloads_statistics();
 		ssd_device->Perform_preconditioning(workload_stats);
 		for (auto &stat : workload_stats) {
 			delete stat;
 		}
+		ssd_device->Save_preconditioning_checkpoint();
 	}
 }
 
@@ -26,6 +26,7 @@ public:
 	void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
 
 	void Attach_ssd_device(SSD_Device* ssd_device);
+	void Precondition_ssd_device();//Called by Start_simulation; may also be called beforehand to obtain the preconditioned device state
 	const std::vector<Host_Components::IO_Flow_Base*> Get_io_flows();
 
 	// 2021.4.9
@@ -256,6 +256,12 @@ void IO_Flow_Parameter_Set_Synthetic::XML_serialize(Utils::XmlWriter& xmlwriter)
 		case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
 			val = "RANDOM_UNIFORM";
 			break;
+		case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+			val = "RANDOM_ZIPFIAN";
+			break;
+		case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+			val = "RANDOM_MULTI_TIER";
+			break;
 		case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 			val = "MIXED_STREAMING_RANDOM";
 			break;
@@ -267,6 +273,20 @@ void IO_Flow_Parameter_Set_Synthetic::XML_serialize(Utils::XmlWriter& xmlwriter)
 	val = std::to_string(Percentage_of_Hot_Region);
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Zipfian_Exponent";
+	val = std::to_string(Zipfian_Exponent);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Address_Tiers";
+	val = "";
+	for (size_t i = 0; i < Tier_Address_Percentages.size(); i++) {
+		if (i > 0) {
+			val += ",";
+		}
+		val += std::to_string(Tier_Address_Percentages[i]) + ":" + std::to_string(Tier_Traffic_Percentages[i]);
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Generated_Aligned_Addresses";
 	val = (Generated_Aligned_Addresses ? "true" : "false");
 	xmlwriter.Write_attribute_string(attr, val);
@@ -353,12 +373,39 @@ void IO_Flow_Parameter_Set_Synthetic::XML_deserialize(rapidxml::xml_node<> *node
 					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_HOTCOLD;
 				} else if (strcmp(val.c_str(), "RANDOM_UNIFORM") == 0) {
 					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_UNIFORM;
+				} else if (strcmp(val.c_str(), "RANDOM_ZIPFIAN") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_ZIPFIAN;
+				} else if (strcmp(val.c_str(), "RANDOM_MULTI_TIER") == 0) {
+					Address_Distribution = Utils::Address_Distribution_Type::RANDOM_MULTI_TIER;
 				} else {
 					PRINT_ERROR("Wrong address distribution type for input synthetic flow")
 				}
 			} else if (strcmp(param->name(), "Percentage_of_Hot_Region") == 0) {
 				std::string val = param->value();
 				Percentage_of_Hot_Region = std::stoi(val);
+			} else if (strcmp(param->name(), "Zipfian_Exponent") == 0) {
+				std::string val = param->value();
+				Zipfian_Exponent = std::stod(val);
+			} else if (strcmp(param->name(), "Address_Tiers") == 0) {
+				//A comma-separated list of address_percentage:traffic_percentage pairs, in the order of the addresses
+				Tier_Address_Percentages.clear();
+				Tier_Traffic_Percentages.clear();
+				std::string tiers = param->value();
+				std::string::size_type tier_start = 0;
+				while (tier_start < tiers.size()) {
+					std::string::size_type tier_end = tiers.find(',', tier_start);
+					if (tier_end == std::string::npos) {
+						tier_end = tiers.size();
+					}
+					std::string val = tiers.substr(tier_start, tier_end - tier_start);
+					std::string::size_type separator = val.find(':');
+					if (separator == std::string::npos) {
+						PRINT_ERROR("Wrong address tier definition for input synthetic flow: " << val)
+					}
+					Tier_Address_Percentages.push_back(std::stod(val.substr(0, separator)));
+					Tier_Traffic_Percentages.push_back(std::stod(val.substr(separator + 1)));
+					tier_start = tier_end + 1;
+				}
 			} else if (strcmp(param->name(), "Generated_Aligned_Addresses") == 0) {
 				std::string val = param->value();
 				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
@@ -415,6 +462,23 @@ void IO_Flow_Parameter_Set_Trace_Based::XML_serialize(Utils::XmlWriter& xmlwrite
 	std::string val = File_Path;
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "File_Format";
+	switch (File_Format) {
+		case Trace_File_Format::MQSIM:
+			val = "MQSIM";
+			break;
+		case Trace_File_Format::BLKPARSE:
+			val = "BLKPARSE";
+			break;
+		case Trace_File_Format::MSR_CAMBRIDGE:
+			val = "MSR_CAMBRIDGE";
+			break;
+		case Trace_File_Format::FIO_IOLOG:
+			val = "FIO_IOLOG";
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
 	attr = "Percentage_To_Be_Executed";
 	val = std::to_string(Percentage_To_Be_Executed);
 	xmlwriter.Write_attribute_string(attr, val);
@@ -437,6 +501,45 @@ void IO_Flow_Parameter_Set_Trace_Based::XML_serialize(Utils::XmlWriter& xmlwrite
 	}
 	xmlwriter.Write_attribute_string(attr, val);
 
+	attr = "Load_Scaling_Factor";
+	val = std::to_string(Load_Scaling_Factor);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Time_Window_Start";
+	val = std::to_string(Time_Window_Start);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Time_Window_End";
+	val = std::to_string(Time_Window_End);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Sampling_Period";
+	val = std::to_string(Sampling_Period);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Sampling_Length";
+	val = std::to_string(Sampling_Length);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Replay_Mode";
+	switch (Replay_Mode) {
+		case Trace_Replay_Mode::TIMESTAMP:
+			val = "TIMESTAMP";
+			break;
+		case Trace_Replay_Mode::QUEUE_DEPTH:
+			val = "QUEUE_DEPTH";
+			break;
+	}
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Queue_Depth";
+	val = std::to_string(Queue_Depth);
+	xmlwriter.Write_attribute_string(attr, val);
+
+	attr = "Think_Time";
+	val = std::to_string(Think_Time);
+	xmlwriter.Write_attribute_string(attr, val);
+
 	xmlwriter.Write_close_tag();
 }
 
@@ -454,6 +557,20 @@ void IO_Flow_Parameter_Set_Trace_Based::XML_deserialize(rapidxml::xml_node<> *no
 				Percentage_To_Be_Executed = std::stoi(val);
 			} else if (strcmp(param->name(), "File_Path") == 0) {
 				File_Path = param->value();
+			} else if (strcmp(param->name(), "File_Format") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "MQSIM") == 0) {
+					File_Format = Trace_File_Format::MQSIM;
+				} else if (strcmp(val.c_str(), "BLKPARSE") == 0) {
+					File_Format = Trace_File_Format::BLKPARSE;
+				} else if (strcmp(val.c_str(), "MSR_CAMBRIDGE") == 0) {
+					File_Format = Trace_File_Format::MSR_CAMBRIDGE;
+				} else if (strcmp(val.c_str(), "FIO_IOLOG") == 0) {
+					File_Format = Trace_File_Format::FIO_IOLOG;
+				} else {
+					PRINT_ERROR("Wrong file format specified for the trace based flow")
+				}
 			} else if (strcmp(param->name(), "Time_Unit") == 0) {
 				std::string val = param->value();
 				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
@@ -466,6 +583,37 @@ void IO_Flow_Parameter_Set_Trace_Based::XML_deserialize(rapidxml::xml_node<> *no
 				} else {
 					PRINT_ERROR("Wrong time unit specified for the trace based flow")
 				}
+			} else if (strcmp(param->name(), "Load_Scaling_Factor") == 0) {
+				std::string val = param->value();
+				Load_Scaling_Factor = std::stod(val);
+			} else if (strcmp(param->name(), "Time_Window_Start") == 0) {
+				std::string val = param->value();
+				Time_Window_Start = std::stoull(val);
+			} else if (strcmp(param->name(), "Time_Window_End") == 0) {
+				std::string val = param->value();
+				Time_Window_End = std::stoull(val);
+			} else if (strcmp(param->name(), "Sampling_Period") == 0) {
+				std::string val = param->value();
+				Sampling_Period = std::stoull(val);
+			} else if (strcmp(param->name(), "Sampling_Length") == 0) {
+				std::string val = param->value();
+				Sampling_Length = std::stoull(val);
+			} else if (strcmp(param->name(), "Replay_Mode") == 0) {
+				std::string val = param->value();
+				std::transform(val.begin(), val.end(), val.begin(), ::toupper);
+				if (strcmp(val.c_str(), "TIMESTAMP") == 0) {
+					Replay_Mode = Trace_Replay_Mode::TIMESTAMP;
+				} else if (strcmp(val.c_str(), "QUEUE_DEPTH") == 0) {
+					Replay_Mode = Trace_Replay_Mode::QUEUE_DEPTH;
+				} else {
+					PRINT_ERROR("Wrong replay mode specified for the trace based flow")
+				}
+			} else if (strcmp(param->name(), "Queue_Depth") == 0) {
+				std::string val = param->value();
+				Queue_Depth = std::stoul(val);
+			} else if (strcmp(param->name(), "Think_Time") == 0) {
+				std::string val = param->value();
+				Think_Time = std::stoull(val);
 			}
 
 		}
@@ -2,6 +2,7 @@
 #define IO_FLOW_PARAMETER_SET_H
 
 #include <string>
+#include <vector>
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "../ssd/Host_Interface_Defs.h"
 #include "../host/IO_Flow_Synthetic.h"
@@ -31,12 +32,15 @@ private:
 class IO_Flow_Parameter_Set_Synthetic : public IO_Flow_Parameter_Set
 {
 public:
-	IO_Flow_Parameter_Set_Synthetic() { this->Type = Flow_Type::SYNTHETIC; }
+	IO_Flow_Parameter_Set_Synthetic() : Zipfian_Exponent(0.99) { this->Type = Flow_Type::SYNTHETIC; }
 	unsigned int Working_Set_Percentage;//Percentage of available storage space that is accessed
 	Utils::Request_Generator_Type Synthetic_Generator_Type;
 	char Read_Percentage;
 	Utils::Address_Distribution_Type Address_Distribution;
 	char Percentage_of_Hot_Region;//This parameters used if the address distribution type is hot/cold (i.e., (100-H)% of the whole I/O requests are going to a H% hot region of the storage space)
+	double Zipfian_Exponent;//This parameter is used if the address distribution type is Zipfian (i.e., the k-th most popular address is accessed with a probability proportional to 1/k^Zipfian_Exponent)
+	std::vector<double> Tier_Address_Percentages;//These parameters are used if the address distribution type is multi-tier (i.e., Tier_Traffic_Percentages[i]% of the whole I/O requests are going to the
+	std::vector<double> Tier_Traffic_Percentages;//i-th region of the storage space, which covers Tier_Address_Percentages[i]% of it)
 	bool Generated_Aligned_Addresses;
 	unsigned int Address_Alignment_Unit;
 	Utils::Request_Size_Distribution_Type Request_Size_Distribution;
@@ -57,11 +61,25 @@ public:
 class IO_Flow_Parameter_Set_Trace_Based : public IO_Flow_Parameter_Set
 {
 public:
-	IO_Flow_Parameter_Set_Trace_Based() { this->Type = Flow_Type::TRACE; }
+	IO_Flow_Parameter_Set_Trace_Based() : Load_Scaling_Factor(1.0), Time_Window_Start(0), Time_Window_End(0), Sampling_Period(0), Sampling_Length(0),
+		Replay_Mode(Trace_Replay_Mode::TIMESTAMP), Queue_Depth(1), Think_Time(0)
+	{
+		this->Type = Flow_Type::TRACE;
+		this->File_Format = Trace_File_Format::MQSIM;
+	}
 	std::string File_Path;
+	Trace_File_Format File_Format;
 	int Percentage_To_Be_Executed;
 	int Relay_Count; 
 	Trace_Time_Unit Time_Unit;
+	double Load_Scaling_Factor;//Arrival times are divided by this factor, to replay the trace at a higher or lower intensity
+	sim_time_type Time_Window_Start;//Only the requests that arrive in the window of the trace are replayed
+	sim_time_type Time_Window_End;//Zero means the end of the trace
+	sim_time_type Sampling_Period;//If it is not zero, only the first Sampling_Length nanoseconds of each period of the window are replayed
+	sim_time_type Sampling_Length;
+	Trace_Replay_Mode Replay_Mode;
+	unsigned int Queue_Depth;//The number of outstanding requests if Replay_Mode is QUEUE_DEPTH
+	sim_time_type Think_Time;//The delay between a completion and the next request if Replay_Mode is QUEUE_DEPTH
 	
 	void XML_serialize(Utils::XmlWriter& xmlwriter);
 	void XML_deserialize(rapidxml::xml_node<> *node);
@@ -7,6 +7,7 @@
 class Parameter_Set_Base
 {
 public:
+	virtual ~Parameter_Set_Base() {}
 	virtual void XML_serialize(Utils::XmlWriter& xmlwriter) = 0;
 	virtual void XML_deserialize(rapidxml::xml_node<> *node) = 0;
 };
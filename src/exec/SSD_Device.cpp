@@ -1,6 +1,7 @@
 #include <vector>
 #include <stdexcept>
 #include <ctime>
+#include <cstdio>
 #include "SSD_Device.h"
 #include "../ssd/ONFI_Channel_Base.h"
 #include "../ssd/Flash_Block_Manager.h"
@@ -17,7 +18,7 @@
 #include "../ssd/NVM_PHY_ONFI_NVDDR2.h"
 #include "../utils/Logical_Address_Partitioning_Unit.h"
 
-SSD_Device *SSD_Device::my_instance; //Used in static functions
+thread_local SSD_Device *SSD_Device::my_instance; //Used in static functions
 
 SSD_Device::SSD_Device(Device_Parameter_Set *parameters, std::vector<IO_Flow_Parameter_Set *> *io_flows) : MQSimEngine::Sim_Object("SSDDevice")
 {
@@ -28,6 +29,22 @@ SSD_Device::SSD_Device(Device_Parameter_Set *parameters, std::vector<IO_Flow_Par
 	device->Preconditioning_required = parameters->Enabled_Preconditioning;
 	device->Memory_Type = parameters->Memory_Type;
 
+	Utils::XmlWriter xmlwriter;
+	xmlwriter.Open_in_memory();
+	parameters->XML_serialize(xmlwriter);
+	std::string trace_versions;
+	for (auto &flow : *io_flows) {
+		flow->XML_serialize(xmlwriter);
+		//The preconditioning of a trace flow depends on the content of its trace file, not only on its path
+		std::string trace_version;
+		if (flow->Type == Flow_Type::TRACE
+			&& Utils::Get_file_version(((IO_Flow_Parameter_Set_Trace_Based*)flow)->File_Path, trace_version)) {
+			trace_versions += trace_version + " ";
+		}
+	}
+	device->preconditioning_checkpoint_key = Utils::Hash_string(trace_versions, Utils::Hash_string(xmlwriter.Get_memory_buffer()));
+	device->preconditioned_state = NULL;
+
 	switch (Memory_Type)
 	{
 	case NVM::NVM_Type::FLASH:
@@ -412,6 +429,107 @@ void SSD_Device::Perform_preconditioning(std::vector<Utils::Workload_Statistics
 	}
 }
 
+void SSD_Device::Set_preconditioning_checkpoint_directory(const std::string& directory)
+{
+	if (directory != "" && Memory_Type == NVM::NVM_Type::FLASH
+		&& dynamic_cast<SSD_Components::Address_Mapping_Unit_Hybrid*>(((SSD_Components::FTL*)this->Firmware)->Address_Mapping_Unit) != NULL) {
+		PRINT_ERROR("Preconditioning checkpoints are not supported with the HYBRID address mapping, remove Checkpoint_Directory from the configuration")
+	}
+	preconditioning_checkpoint_directory = directory;
+}
+
+std::string SSD_Device::get_preconditioning_checkpoint_path()
+{
+	char key[17];
+	snprintf(key, sizeof(key), "%016llx", (unsigned long long)preconditioning_checkpoint_key);
+	std::string path = preconditioning_checkpoint_directory;
+	if (path.back() != '/' && path.back() != '\\') {
+		path += '/';
+	}
+
+	return path + "precondition_" + key + ".ckpt";
+}
+
+bool SSD_Device::Load_preconditioning_checkpoint()
+{
+	if (!Preconditioning_required || Memory_Type != NVM::NVM_Type::FLASH) {
+		return false;
+	}
+
+	Utils::Checkpoint_Reader reader;
+	if (preconditioned_state != NULL) {
+		//The in-memory state may come from a device with different runtime parameters, so it is not keyed by the configuration
+		if (!reader.Open_in_memory(*preconditioned_state, 0)) {
+			PRINT_ERROR("The preconditioned SSD state is corrupted")
+		}
+	} else {
+		if (preconditioning_checkpoint_directory == "" || !reader.Open(get_preconditioning_checkpoint_path(), preconditioning_checkpoint_key)) {
+			return false;
+		}
+		std::cout << "Loading the preconditioned SSD state from " << get_preconditioning_checkpoint_path() << std::endl;
+	}
+	load_state(reader);
+	reader.Close();
+
+	return true;
+}
+
+void SSD_Device::Save_preconditioning_checkpoint()
+{
+	if (!Preconditioning_required || preconditioning_checkpoint_directory == "" || Memory_Type != NVM::NVM_Type::FLASH) {
+		return;
+	}
+
+	Utils::Checkpoint_Writer writer;
+	if (!writer.Open(get_preconditioning_checkpoint_path(), preconditioning_checkpoint_key)) {
+		std::cerr << "Warning: unable to create the preconditioning checkpoint " << get_preconditioning_checkpoint_path() << std::endl;
+		return;
+	}
+	save_state(writer);
+	if (!writer.Close()) {
+		std::cerr << "Warning: unable to write the preconditioning checkpoint " << get_preconditioning_checkpoint_path() << std::endl;
+	}
+}
+
+void SSD_Device::Save_preconditioned_state(std::string& state)
+{
+	state = "";
+	if (!Preconditioning_required || Memory_Type != NVM::NVM_Type::FLASH) {
+		return;
+	}
+
+	Utils::Checkpoint_Writer writer;
+	writer.Open_in_memory(0);
+	save_state(writer);
+	writer.Close();
+	state = writer.Get_memory_buffer();
+}
+
+void SSD_Device::Set_preconditioned_state(const std::string* state)
+{
+	preconditioned_state = state;
+}
+
+void SSD_Device::save_state(Utils::Checkpoint_Writer& writer)
+{
+	((SSD_Components::FTL *)this->Firmware)->Save_checkpoint(writer);
+	for (unsigned int channel_cntr = 0; channel_cntr < Channel_count; channel_cntr++) {
+		for (unsigned int chip_cntr = 0; chip_cntr < Chip_no_per_channel; chip_cntr++) {
+			((SSD_Components::ONFI_Channel_NVDDR2 *)Channels[channel_cntr])->Chips[chip_cntr]->Save_checkpoint(writer);
+		}
+	}
+}
+
+void SSD_Device::load_state(Utils::Checkpoint_Reader& reader)
+{
+	((SSD_Components::FTL *)this->Firmware)->Load_checkpoint(reader);
+	for (unsigned int channel_cntr = 0; channel_cntr < Channel_count; channel_cntr++) {
+		for (unsigned int chip_cntr = 0; chip_cntr < Chip_no_per_channel; chip_cntr++) {
+			((SSD_Components::ONFI_Channel_NVDDR2 *)Channels[channel_cntr])->Chips[chip_cntr]->Load_checkpoint(reader);
+		}
+	}
+}
+
 void SSD_Device::Start_simulation()
 {
 }
@@ -1,6 +1,7 @@
 #ifndef SSD_DEVICE_H
 #define SSD_DEVICE_H
 
+#include <string>
 #include <vector>
 #include "../sim/Sim_Object.h"
 #include "../sim/Sim_Reporter.h"
@@ -18,6 +19,7 @@
 #include "Device_Parameter_Set.h"
 #include "IO_Flow_Parameter_Set.h"
 #include "../utils/Workload_Statistics.h"
+#include "../utils/Checkpoint.h"
 
 /*********************************************************************************************************
 * An SSD device has the following components:
@@ -43,6 +45,11 @@ public:
 
 	void Attach_to_host(Host_Components::PCIe_Switch* pcie_switch);
 	void Perform_preconditioning(std::vector<Utils::Workload_Statistics*> workload_stats);
+	void Set_preconditioning_checkpoint_directory(const std::string& directory);//An empty directory disables checkpointing
+	bool Load_preconditioning_checkpoint();//Returns false if there is no checkpoint for the current device configuration and I/O flows
+	void Save_preconditioning_checkpoint();
+	void Save_preconditioned_state(std::string& state);//Serializes the preconditioned state into memory, e.g., to share it with forked simulation processes
+	void Set_preconditioned_state(const std::string* state);//If set, Load_preconditioning_checkpoint restores the device from this state instead of a checkpoint file
 	void Start_simulation();
 	void Validate_simulation_config();
 	void Execute_simulator_event(MQSimEngine::Sim_Event* event);
@@ -53,7 +60,13 @@ public:
 	unsigned int Chip_no_per_channel;
 
 private:
-	static SSD_Device * my_instance;//Used in static functions
+	static thread_local SSD_Device * my_instance;//Used in static functions
+	std::string preconditioning_checkpoint_directory;
+	uint64_t preconditioning_checkpoint_key;//The hash of the device configuration and the I/O flow definitions that the preconditioned state depends on
+	const std::string* preconditioned_state;
+	std::string get_preconditioning_checkpoint_path();
+	void save_state(Utils::Checkpoint_Writer& writer);
+	void load_state(Utils::Checkpoint_Reader& reader);
 };
 
 #endif //!SSD_DEVICE_H
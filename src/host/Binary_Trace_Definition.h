@@ -0,0 +1,37 @@
+#ifndef BINARY_TRACE_DEFINITION_H
+#define BINARY_TRACE_DEFINITION_H
+
+#include <cstdint>
+
+/*
+* The packed binary trace format: a header followed by fixed-width records in the host byte order, so that
+* a record is decoded by a plain copy from the memory-mapped file instead of string parsing.
+* A binary trace is created from an ASCII trace (ASCII_Trace_Definition.h) by MQSimTraceConverter.
+*/
+#define BinaryTraceMagic 0x4352544D4953514DULL //"MQSIMTRC"
+#define BinaryTraceVersion 1
+#define BinaryTraceWriteCode 0 //Same codes as the ASCII format
+#define BinaryTraceReadCode 1
+
+struct Binary_Trace_Header
+{
+	uint64_t Magic;
+	uint32_t Version;
+	uint32_t Record_size;//sizeof(Binary_Trace_Record), checked by the reader
+	uint64_t Record_count;
+};
+
+struct Binary_Trace_Record
+{
+	uint64_t Time;//Arrival time with the same unit as the ASCII trace
+	uint64_t Start_LBA;
+	uint32_t LBA_count;
+	uint16_t Device;
+	uint8_t Type;//BinaryTraceWriteCode or BinaryTraceReadCode
+	uint8_t Reserved;
+};
+
+static_assert(sizeof(Binary_Trace_Header) == 24, "The binary trace header must be packed");
+static_assert(sizeof(Binary_Trace_Record) == 24, "The binary trace records must be packed");
+
+#endif // !BINARY_TRACE_DEFINITION_H
@@ -9,6 +9,7 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 	LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
 	uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class::Priority priority_class,
 	double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_region_ratio,
+	double zipfian_exponent, const std::vector<double>& tier_address_ratios, const std::vector<double>& tier_traffic_ratios,
 	Utils::Request_Size_Distribution_Type request_size_distribution, unsigned int average_request_size, unsigned int variance_request_size,
 	Utils::Request_Generator_Type generator_type, sim_time_type Average_inter_arrival_time_nano_sec, unsigned int average_number_of_enqueued_requests,
 	bool generate_aligned_addresses, unsigned int alignment_value,
@@ -16,6 +17,7 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 	bool enabled_logging, sim_time_type logging_period, std::string logging_file_path)
 		: IO_Flow_Base(name, flow_id, start_lsa_on_device, LHA_type(start_lsa_on_device + (end_lsa_on_device - start_lsa_on_device) * working_set_ratio), io_queue_id, nvme_submission_queue_size, nvme_completion_queue_size, priority_class, stop_time, initial_occupancy_ratio, total_req_count, SSD_device_type, pcie_root_complex, sata_hba, enabled_logging, logging_period, logging_file_path),
 			read_ratio(read_ratio), working_set_ratio(working_set_ratio), address_distribution(address_distribution), hot_region_ratio(hot_region_ratio),
+			zipfian_exponent(zipfian_exponent), tier_address_ratios(tier_address_ratios), tier_traffic_ratios(tier_traffic_ratios),
 			request_size_distribution(request_size_distribution), average_request_size(average_request_size), variance_request_size(variance_request_size),
 			generator_type(generator_type), Average_inter_arrival_time_nano_sec(Average_inter_arrival_time_nano_sec),
 			average_number_of_enqueued_requests(average_number_of_enqueued_requests), generate_aligned_addresses(generate_aligned_addresses),
@@ -44,6 +46,63 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 		hot_region_end_lsa = this->start_lsa_on_device + (LHA_type)((double)(this->end_lsa_on_device - this->start_lsa_on_device) * hot_region_ratio);
 	}
 
+	if (address_distribution == Utils::Address_Distribution_Type::RANDOM_ZIPFIAN)
+	{
+		if (zipfian_exponent <= 0)
+		{
+			PRINT_ERROR("The Zipfian exponent should be greater than zero for workload " << name)
+		}
+		zipfian_item_size = average_request_size > 0 ? average_request_size : 1;
+		if (generate_aligned_addresses && alignment_value > 0 && zipfian_item_size % alignment_value != 0)
+		{
+			zipfian_item_size += alignment_value - zipfian_item_size % alignment_value;
+		}
+		if (this->end_lsa_on_device - this->start_lsa_on_device + 1 < zipfian_item_size)
+		{
+			PRINT_ERROR("The working set of workload " << name << " is smaller than the average request size")
+		}
+		random_hot_address_generator_seed = seed++;
+		random_hot_address_generator = new Utils::RandomGenerator(random_hot_address_generator_seed);
+		zipfian_generator = new Utils::Zipfian_Generator((this->end_lsa_on_device - this->start_lsa_on_device + 1) / zipfian_item_size, zipfian_exponent);
+	}
+
+	if (address_distribution == Utils::Address_Distribution_Type::RANDOM_MULTI_TIER)
+	{
+		if (tier_address_ratios.size() == 0 || tier_address_ratios.size() != tier_traffic_ratios.size())
+		{
+			PRINT_ERROR("No address tiers are defined for workload " << name)
+		}
+		double address_ratio_sum = 0, traffic_ratio_sum = 0;
+		for (size_t tier = 0; tier < tier_address_ratios.size(); tier++)
+		{
+			if (tier_address_ratios[tier] <= 0 || tier_traffic_ratios[tier] < 0)
+			{
+				PRINT_ERROR("Wrong address tier definition for workload " << name)
+			}
+			tier_start_lsa.push_back(this->start_lsa_on_device + (LHA_type)((double)(this->end_lsa_on_device - this->start_lsa_on_device + 1) * address_ratio_sum));
+			address_ratio_sum += tier_address_ratios[tier];
+			traffic_ratio_sum += tier_traffic_ratios[tier];
+		}
+		if (fabs(address_ratio_sum - 1) > 0.001 || fabs(traffic_ratio_sum - 1) > 0.001)
+		{
+			PRINT_ERROR("The address and traffic percentages of the tiers should each sum up to 100 for workload " << name)
+		}
+		tier_start_lsa.push_back(this->end_lsa_on_device + 1);
+		for (size_t tier = 0; tier < tier_address_ratios.size(); tier++)
+		{
+			//Each tier must be able to hold a request, otherwise the requests of the tier do not fit into its addresses
+			if (tier_start_lsa[tier + 1] == tier_start_lsa[tier] || tier_start_lsa[tier + 1] - tier_start_lsa[tier] < average_request_size)
+			{
+				PRINT_ERROR("Address tier " << tier + 1 << " of workload " << name << " is smaller than the average request size, increase its address percentage")
+			}
+		}
+		random_hot_address_generator_seed = seed++;
+		random_hot_address_generator = new Utils::RandomGenerator(random_hot_address_generator_seed);
+		random_hot_cold_generator_seed = seed++;
+		random_hot_cold_generator = new Utils::RandomGenerator(random_hot_cold_generator_seed);
+		tier_selector = new Utils::Alias_Table(tier_traffic_ratios);
+	}
+
 	if (request_size_distribution == Utils::Request_Size_Distribution_Type::NORMAL)
 	{
 		random_request_size_generator_seed = seed++;
@@ -68,6 +127,8 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 		delete random_address_generator;
 		delete random_hot_cold_generator;
 		delete random_hot_address_generator;
+		delete zipfian_generator;
+		delete tier_selector;
 		delete random_request_size_generator;
 		delete random_time_interval_generator;
 	}
@@ -144,6 +205,32 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 					}
 				}
 				break;
+			case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+				//The most popular items are placed at the start of the working set
+				if (start_lsa_on_device + request->LBA_count > end_lsa_on_device) {
+					request->Start_LBA = start_lsa_on_device;
+					break;
+				}
+				//A request that overruns the working set is resampled, which keeps the relative popularity of the items that fit
+				do {
+					request->Start_LBA = start_lsa_on_device + (zipfian_generator->Sample(*random_hot_address_generator) - 1) * zipfian_item_size;
+				} while (request->Start_LBA + request->LBA_count > end_lsa_on_device);
+				break;
+			case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+			{
+				unsigned int tier = tier_selector->Sample(*random_hot_cold_generator);
+				request->Start_LBA = random_hot_address_generator->Uniform_ulong(tier_start_lsa[tier], tier_start_lsa[tier + 1] - 1);
+				if (request->Start_LBA < tier_start_lsa[tier] || request->Start_LBA >= tier_start_lsa[tier + 1]) {
+					PRINT_ERROR("Out of range address is generated in IO_Flow_Synthetic!\n")
+				}
+				if (request->Start_LBA + request->LBA_count > end_lsa_on_device) {
+					request->Start_LBA = tier_start_lsa[tier];
+					if (request->Start_LBA + request->LBA_count > end_lsa_on_device) {//A request of the normal size distribution may be larger than the last tier
+						request->Start_LBA = start_lsa_on_device;
+					}
+				}
+				break;
+			}
 			case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
 				request->Start_LBA = random_address_generator->Uniform_ulong(start_lsa_on_device, end_lsa_on_device);
 				if (request->Start_LBA < start_lsa_on_device || request->Start_LBA > end_lsa_on_device) {
@@ -245,6 +332,25 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 		stats.Address_distribution_type = address_distribution;
 		stats.Ratio_of_hot_addresses_to_whole_working_set = hot_region_ratio;
 		stats.Ratio_of_traffic_accessing_hot_region = 1 - hot_region_ratio;
+		stats.Zipfian_exponent = zipfian_exponent;
+		stats.Tier_address_ratios = tier_address_ratios;
+		stats.Tier_traffic_ratios = tier_traffic_ratios;
+		if (address_distribution == Utils::Address_Distribution_Type::RANDOM_ZIPFIAN) {
+			//The ranks that are more popular than the average form the hot region
+			uint64_t hot_rank_count = zipfian_generator->Above_average_rank_count();
+			stats.Ratio_of_hot_addresses_to_whole_working_set = (double)hot_rank_count * zipfian_item_size / (double)(end_lsa_on_device - start_lsa_on_device + 1);
+			stats.Ratio_of_traffic_accessing_hot_region = zipfian_generator->Top_ranks_share(hot_rank_count);
+		} else if (address_distribution == Utils::Address_Distribution_Type::RANDOM_MULTI_TIER) {
+			//The tiers that receive more than their share of the traffic form the hot region
+			stats.Ratio_of_hot_addresses_to_whole_working_set = 0;
+			stats.Ratio_of_traffic_accessing_hot_region = 0;
+			for (size_t tier = 0; tier < tier_address_ratios.size(); tier++) {
+				if (tier_traffic_ratios[tier] > tier_address_ratios[tier]) {
+					stats.Ratio_of_hot_addresses_to_whole_working_set += tier_address_ratios[tier];
+					stats.Ratio_of_traffic_accessing_hot_region += tier_traffic_ratios[tier];
+				}
+			}
+		}
 		stats.random_address_generator_seed = random_address_generator_seed;
 		stats.random_hot_address_generator_seed = random_hot_address_generator_seed;
 		stats.random_hot_cold_generator_seed = random_hot_cold_generator_seed;
@@ -255,6 +361,7 @@ IO_Flow_Synthetic::IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t fl
 		stats.STDEV_reuqest_size = variance_request_size;
 		stats.random_request_size_generator_seed = random_request_size_generator_seed;
 		stats.Request_queue_depth = average_number_of_enqueued_requests;
+		stats.Think_time = 0;
 		stats.random_time_interval_generator_seed = random_time_interval_generator_seed;
 		stats.Average_inter_arrival_time_nano_sec = Average_inter_arrival_time_nano_sec;
 		stats.Min_LHA = start_lsa_on_device;
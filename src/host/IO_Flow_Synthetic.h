@@ -2,8 +2,11 @@
 #define IO_FLOW_SYNTHETIC_H
 
 #include <string>
+#include <vector>
 #include "IO_Flow_Base.h"
 #include "../utils/RandomGenerator.h"
+#include "../utils/Zipfian_Generator.h"
+#include "../utils/Alias_Table.h"
 #include "../utils/DistributionTypes.h"
 
 namespace Host_Components
@@ -14,6 +17,7 @@ public:
 	IO_Flow_Synthetic(const sim_object_id_type &name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, double working_set_ratio, uint16_t io_queue_id,
 					  uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class::Priority priority_class,
 					  double read_ratio, Utils::Address_Distribution_Type address_distribution, double hot_address_ratio,
+					  double zipfian_exponent, const std::vector<double>& tier_address_ratios, const std::vector<double>& tier_traffic_ratios,
 					  Utils::Request_Size_Distribution_Type request_size_distribution, unsigned int average_request_size, unsigned int variance_request_size,
 					  Utils::Request_Generator_Type generator_type, sim_time_type Average_inter_arrival_time_nano_sec, unsigned int average_number_of_enqueued_requests,
 					  bool generate_aligned_addresses, unsigned int alignment_value,
@@ -38,19 +42,25 @@ private:
 	double hot_region_ratio;
 	Utils::RandomGenerator *random_address_generator;
 	int random_address_generator_seed;
-	Utils::RandomGenerator *random_hot_cold_generator;
+	Utils::RandomGenerator *random_hot_cold_generator = NULL;
 	int random_hot_cold_generator_seed;
-	Utils::RandomGenerator *random_hot_address_generator;
+	Utils::RandomGenerator *random_hot_address_generator = NULL;
 	int random_hot_address_generator_seed;
 	LHA_type hot_region_end_lsa;
+	double zipfian_exponent;
+	Utils::Zipfian_Generator *zipfian_generator = NULL;//Rank k is mapped to the k-th item of the working set
+	unsigned int zipfian_item_size = 1;//The items are request-sized, so that the requests of different ranks do not overlap
+	std::vector<double> tier_address_ratios, tier_traffic_ratios;
+	std::vector<LHA_type> tier_start_lsa;//The start address of each tier, followed by the end address of the working set plus one
+	Utils::Alias_Table *tier_selector = NULL;
 	LHA_type streaming_next_address;
 	Utils::Request_Size_Distribution_Type request_size_distribution;
 	unsigned int average_request_size;
 	unsigned int variance_request_size;
-	Utils::RandomGenerator *random_request_size_generator;
+	Utils::RandomGenerator *random_request_size_generator = NULL;
 	int random_request_size_generator_seed;
 	Utils::Request_Generator_Type generator_type;
-	Utils::RandomGenerator *random_time_interval_generator;
+	Utils::RandomGenerator *random_time_interval_generator = NULL;
 	int random_time_interval_generator_seed;
 	sim_time_type Average_inter_arrival_time_nano_sec;
 	unsigned int average_number_of_enqueued_requests;
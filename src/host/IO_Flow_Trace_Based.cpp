@@ -2,62 +2,78 @@
 #include "../utils/StringTools.h"
 #include "ASCII_Trace_Definition.h"
 #include "../utils/DistributionTypes.h"
+#include "../utils/Checkpoint.h"
 
 namespace Host_Components
 {
 IO_Flow_Trace_Based::IO_Flow_Trace_Based(const sim_object_id_type &name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, uint16_t io_queue_id,
 	uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class::Priority priority_class, double initial_occupancy_ratio,
-	std::string trace_file_path, Trace_Time_Unit time_unit, unsigned int total_replay_count, unsigned int percentage_to_be_simulated,
+	std::string trace_file_path, Trace_File_Format trace_file_format, Trace_Time_Unit time_unit, unsigned int total_replay_count, unsigned int percentage_to_be_simulated,
+	const Trace_Sampling_Parameters &sampling_parameters, Trace_Replay_Mode replay_mode, unsigned int queue_depth, sim_time_type think_time,
 	HostInterface_Types SSD_device_type, PCIe_Root_Complex *pcie_root_complex, SATA_HBA *sata_hba,
 	bool enabled_logging, sim_time_type logging_period, std::string logging_file_path)
 	: IO_Flow_Base(name, flow_id, start_lsa_on_device, end_lsa_on_device, io_queue_id, nvme_submission_queue_size, nvme_completion_queue_size, priority_class, 0, initial_occupancy_ratio, 0, SSD_device_type, pcie_root_complex, sata_hba, enabled_logging, logging_period, logging_file_path),
-		trace_file_path(trace_file_path), time_unit(time_unit), percentage_to_be_simulated(percentage_to_be_simulated),
-		total_replay_no(total_replay_count), total_requests_in_file(0), time_offset(0)
+		trace_file_path(trace_file_path), trace_file_format(trace_file_format), time_unit(time_unit), percentage_to_be_simulated(percentage_to_be_simulated), sampling_parameters(sampling_parameters),
+		replay_mode(replay_mode), queue_depth(queue_depth), think_time(think_time),
+		trace_reader(NULL), trace_prefetcher(NULL), total_replay_no(total_replay_count), total_requests_in_file(0), has_current_request(false), trace_ingested(false)
 {
 	if (percentage_to_be_simulated > 100)
 	{
 		percentage_to_be_simulated = 100;
 		PRINT_MESSAGE("Bad value for percentage of trace file! It is set to 100 % ");
 	}
+	if (sampling_parameters.Load_scaling_factor <= 0)
+	{
+		PRINT_ERROR("The load scaling factor of the trace based flow " << name << " must be positive")
+	}
+	if (sampling_parameters.Window_end != 0 && sampling_parameters.Window_end <= sampling_parameters.Window_start)
+	{
+		PRINT_ERROR("The time window of the trace based flow " << name << " is empty")
+	}
+	if (sampling_parameters.Sampling_period != 0 && (sampling_parameters.Sampling_length == 0 || sampling_parameters.Sampling_length > sampling_parameters.Sampling_period))
+	{
+		PRINT_ERROR("The sampling length of the trace based flow " << name << " must be in the range 1 to its sampling period")
+	}
+	if (replay_mode == Trace_Replay_Mode::QUEUE_DEPTH && queue_depth == 0)
+	{
+		PRINT_ERROR("The queue depth of the trace based flow " << name << " must be positive")
+	}
 }
 
 IO_Flow_Trace_Based::~IO_Flow_Trace_Based()
 {
+	delete trace_prefetcher;//Stops the reader thread before its trace reader is deleted
+	delete trace_reader;
 }
 
 Host_IO_Request *IO_Flow_Trace_Based::Generate_next_request()
 {
-	if (current_trace_line.size() == 0 || STAT_generated_request_count >= total_requests_to_be_generated)
+	if (!has_current_request || STAT_generated_request_count >= total_requests_to_be_generated)
 	{
 		return NULL;
 	}
 
 	Host_IO_Request *request = new Host_IO_Request;
-	if (current_trace_line[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0)
+	request->Type = current_request.Type;
+	if (request->Type == Host_IO_Request_Type::WRITE)
 	{
-		request->Type = Host_IO_Request_Type::WRITE;
 		STAT_generated_write_request_count++;
 	}
 	else
 	{
-		request->Type = Host_IO_Request_Type::READ;
 		STAT_generated_read_request_count++;
 	}
 
-	char *pEnd;
-	request->LBA_count = std::strtoul(current_trace_line[ASCIITraceSizeColumn].c_str(), &pEnd, 0);
-
-	request->Start_LBA = std::strtoull(current_trace_line[ASCIITraceAddressColumn].c_str(), &pEnd, 0);
-	if (request->Start_LBA <= (end_lsa_on_device - start_lsa_on_device))
+	request->LBA_count = current_request.LBA_count;
+	request->Start_LBA = current_request.Start_LBA;
+	if (replay_mode == Trace_Replay_Mode::QUEUE_DEPTH)
 	{
-		request->Start_LBA += start_lsa_on_device;
+		request->Arrival_time = Simulator->Time();
 	}
 	else
 	{
-		request->Start_LBA = start_lsa_on_device + request->Start_LBA % (end_lsa_on_device - start_lsa_on_device);
+		request->Arrival_time = current_request.Time_offset + Simulator->Time();
 	}
-
-	request->Arrival_time = time_offset + Simulator->Time();
 	STAT_generated_request_count++;
 
 	return request;
@@ -67,47 +83,25 @@ void IO_Flow_Trace_Based::NVMe_consume_io_request(Completion_Queue_Entry *io_req
 {
 	IO_Flow_Base::NVMe_consume_io_request(io_request);
 	IO_Flow_Base::NVMe_update_and_submit_completion_queue_tail();
+	request_completed();
 }
 
 void IO_Flow_Trace_Based::SATA_consume_io_request(Host_IO_Request *io_request)
 {
 	IO_Flow_Base::SATA_consume_io_request(io_request);
+	request_completed();
 }
 
 void IO_Flow_Trace_Based::Start_simulation()
 {
 	IO_Flow_Base::Start_simulation();
-	std::string trace_line;
-	char *pEnd;
 
-	trace_file.open(trace_file_path, std::ios::in);
-	if (!trace_file.is_open())
+	//The trace is only scanned here if Get_statistics has not already done it for preconditioning
+	if (!trace_ingested && !load_trace_statistics(NULL, NULL, NULL))
 	{
-		PRINT_ERROR("Error while opening input trace file: " << trace_file_path)
+		ingest_trace(NULL, NULL, NULL);
+		save_trace_statistics(NULL, NULL, NULL);
 	}
-	PRINT_MESSAGE("Investigating input trace file: " << trace_file_path);
-
-	sim_time_type last_request_arrival_time = 0;
-	while (std::getline(trace_file, trace_line))
-	{
-		Utils::Helper_Functions::Remove_cr(trace_line);
-		current_trace_line.clear();
-		Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
-		if (current_trace_line.size() != ASCIIItemsPerLine)
-		{
-			break;
-		}
-		total_requests_in_file++;
-		sim_time_type prev_time = last_request_arrival_time;
-		last_request_arrival_time = std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
-		if (last_request_arrival_time < prev_time)
-		{
-			PRINT_ERROR("Unexpected request arrival time: " << last_request_arrival_time << "\nMQSim expects request arrival times to be monotonically increasing in the input trace!")
-		}
-	}
-
-	trace_file.close();
-	PRINT_MESSAGE("Trace file: " << trace_file_path << " seems healthy");
 
 	if (total_replay_no == 1)
 	{
@@ -118,20 +112,41 @@ void IO_Flow_Trace_Based::Start_simulation()
 		total_requests_to_be_generated = total_requests_in_file * total_replay_no;
 	}
 
-	trace_file.open(trace_file_path);
-	current_trace_line.clear();
-	std::getline(trace_file, trace_line);
-	Utils::Helper_Functions::Remove_cr(trace_line);
-	Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
-	Simulator->Register_sim_event(std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10), this);
+	trace_reader = create_trace_reader();
+	if (!trace_reader->Open(trace_file_path))
+	{
+		PRINT_ERROR("Error while opening input trace file: " << trace_file_path)
+	}
+	trace_prefetcher = new Trace_Prefetcher(trace_reader, total_requests_to_be_generated, total_replay_no, start_lsa_on_device, end_lsa_on_device);
+	trace_prefetcher->Start();
+	has_current_request = trace_prefetcher->Next(current_request);
+	if (replay_mode == Trace_Replay_Mode::QUEUE_DEPTH)
+	{
+		Simulator->Register_sim_event((sim_time_type)1, this, 0, 0);
+	}
+	else if (has_current_request)
+	{
+		Simulator->Register_sim_event(current_request.Event_time, this);
+	}
 }
 
 void IO_Flow_Trace_Based::Validate_simulation_config()
 {
 }
 
-void IO_Flow_Trace_Based::Execute_simulator_event(MQSimEngine::Sim_Event *)
+void IO_Flow_Trace_Based::Execute_simulator_event(MQSimEngine::Sim_Event *event)
 {
+	if (replay_mode == Trace_Replay_Mode::QUEUE_DEPTH)
+	{
+		//The first event fills all the slots, and each think time event refills the slot of one completed request
+		unsigned int request_count = event->Type == TRACE_THINK_TIME_EVENT ? 1 : queue_depth;
+		for (unsigned int i = 0; i < request_count; i++)
+		{
+			submit_next_request();
+		}
+		return;
+	}
+
 	Host_IO_Request *request = Generate_next_request();
 	if (request != NULL)
 	{
@@ -140,27 +155,11 @@ void IO_Flow_Trace_Based::Execute_simulator_event(MQSimEngine::Sim_Event *)
 
 	if (STAT_generated_request_count < total_requests_to_be_generated)
 	{
-		std::string trace_line;
-		if (std::getline(trace_file, trace_line))
-		{
-			Utils::Helper_Functions::Remove_cr(trace_line);
-			current_trace_line.clear();
-			Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
-		}
-		else
+		has_current_request = trace_prefetcher->Next(current_request);
+		if (has_current_request)
 		{
-			trace_file.close();
-			trace_file.open(trace_file_path);
-			replay_counter++;
-			time_offset = Simulator->Time();
-			std::getline(trace_file, trace_line);
-			Utils::Helper_Functions::Remove_cr(trace_line);
-			current_trace_line.clear();
-			Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, current_trace_line);
-			PRINT_MESSAGE("* Replay round " << replay_counter << "of " << total_replay_no << " started  for" << ID())
+			Simulator->Register_sim_event(current_request.Event_time, this);
 		}
-		char *pEnd;
-		Simulator->Register_sim_event(time_offset + std::strtoll(current_trace_line[ASCIITraceTimeColumn].c_str(), &pEnd, 10), this);
 	}
 }
 
@@ -184,40 +183,106 @@ void IO_Flow_Trace_Based::Get_statistics(Utils::Workload_Statistics &stats, LPA_
 	stats.Total_generated_requests = 0;
 	stats.Total_accessed_lbas = 0;
 
-	std::ifstream trace_file_temp;
-	trace_file_temp.open(trace_file_path, std::ios::in);
-	if (!trace_file_temp.is_open())
+	if (!load_trace_statistics(&stats, Convert_host_logical_address_to_device_address, Find_NVM_subunit_access_bitmap))
+	{
+		ingest_trace(&stats, Convert_host_logical_address_to_device_address, Find_NVM_subunit_access_bitmap);
+		save_trace_statistics(&stats, Convert_host_logical_address_to_device_address, Find_NVM_subunit_access_bitmap);
+	}
+
+	stats.Initial_occupancy_ratio = initial_occupancy_ratio;
+	stats.Replay_no = total_replay_no;
+
+	//The arrival rate that preconditioning assumes for the flow follows its replay mode, like for a synthetic flow
+	uint64_t read_request_count = 0;
+	for (auto bin : stats.Read_size_histogram)
+	{
+		read_request_count += bin;
+	}
+	stats.Read_ratio = stats.Total_generated_requests == 0 ? 0 : double(read_request_count) / double(stats.Total_generated_requests);
+	stats.generator_type = replay_mode == Trace_Replay_Mode::QUEUE_DEPTH ? Utils::Request_Generator_Type::QUEUE_DEPTH : Utils::Request_Generator_Type::BANDWIDTH;
+	stats.Request_queue_depth = queue_depth;
+	stats.Think_time = think_time;
+}
+
+//Submits the next request of the trace in the QUEUE_DEPTH mode, in the order of the trace
+void IO_Flow_Trace_Based::submit_next_request()
+{
+	Host_IO_Request *request = Generate_next_request();
+	if (request == NULL)
+	{
+		return;
+	}
+	Submit_io_request(request);
+	if (STAT_generated_request_count < total_requests_to_be_generated)
 	{
-		PRINT_ERROR("Error while opening the input trace file!")
+		has_current_request = trace_prefetcher->Next(current_request);
 	}
+}
 
-	std::string trace_line;
-	char *pEnd;
+void IO_Flow_Trace_Based::request_completed()
+{
+	if (replay_mode != Trace_Replay_Mode::QUEUE_DEPTH)
+	{
+		return;
+	}
+
+	if (think_time == 0)
+	{
+		submit_next_request();
+	}
+	else
+	{
+		Simulator->Register_sim_event(Simulator->Time() + think_time, this, 0, TRACE_THINK_TIME_EVENT);
+	}
+}
+
+Trace_Reader *IO_Flow_Trace_Based::create_trace_reader()
+{
+	Trace_Reader *reader = Trace_Reader::Create(trace_file_path, trace_file_format);
+	if (sampling_parameters.Is_identity())
+	{
+		return reader;
+	}
+
+	return new Sampling_Trace_Reader(reader, sampling_parameters);
+}
+
+//Counts and validates the requests of the trace, and if stats is not NULL, also computes its workload statistics in the same pass
+void IO_Flow_Trace_Based::ingest_trace(Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+									   page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha))
+{
+	Trace_Reader *trace_reader_temp = create_trace_reader();
+	if (!trace_reader_temp->Open(trace_file_path))
+	{
+		PRINT_ERROR("Error while opening input trace file: " << trace_file_path)
+	}
+	PRINT_MESSAGE("Investigating input trace file: " << trace_file_path);
+
+	total_requests_in_file = 0;
+
+	Trace_Record record;
 	sim_time_type last_request_arrival_time = 0;
 	sim_time_type sum_inter_arrival = 0;
 	uint64_t sum_request_size = 0;
-	std::vector<std::string> line_splitted;
-	while (std::getline(trace_file_temp, trace_line))
+	while (trace_reader_temp->Read_next(record))
 	{
-		Utils::Helper_Functions::Remove_cr(trace_line);
-		line_splitted.clear();
-		Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, line_splitted);
-		if (line_splitted.size() != ASCIIItemsPerLine)
-		{
-			break;
-		}
 		sim_time_type prev_time = last_request_arrival_time;
-		last_request_arrival_time = std::strtoull(line_splitted[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
+		last_request_arrival_time = record.Arrival_time;
 		if (last_request_arrival_time < prev_time)
 		{
-			PRINT_ERROR("Unexpected request arrival time: " << last_request_arrival_time << "\nMQSim expects request arrival times to be monotonic increasing in the input trace!")
+			PRINT_ERROR("Unexpected request arrival time: " << last_request_arrival_time << "\nMQSim expects request arrival times to be monotonically increasing in the input trace!")
+		}
+		total_requests_in_file++;
+		if (stats == NULL)
+		{
+			continue;
 		}
 		sim_time_type diff = (last_request_arrival_time - prev_time) / 1000; //The arrival rate histogram is stored in the microsecond unit
 		sum_inter_arrival += last_request_arrival_time - prev_time;
 
-		unsigned int LBA_count = std::strtoul(line_splitted[ASCIITraceSizeColumn].c_str(), &pEnd, 0);
+		unsigned int LBA_count = record.LBA_count;
 		sum_request_size += LBA_count;
-		LHA_type start_LBA = std::strtoull(line_splitted[ASCIITraceAddressColumn].c_str(), &pEnd, 0);
+		LHA_type start_LBA = record.Start_LBA;
 		if (start_LBA <= (end_lsa_on_device - start_lsa_on_device))
 		{
 			start_LBA += start_lsa_on_device;
@@ -237,47 +302,47 @@ void IO_Flow_Trace_Based::Get_statistics(Utils::Workload_Statistics &stats, LPA_
 		{
 			LPA_type device_address = Convert_host_logical_address_to_device_address(start_LBA);
 			page_status_type access_status_bitmap = Find_NVM_subunit_access_bitmap(start_LBA);
-			if (line_splitted[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0)
+			if (record.Type == Host_IO_Request_Type::WRITE)
 			{
-				if (stats.Write_address_access_pattern.find(device_address) == stats.Write_address_access_pattern.end())
+				if (stats->Write_address_access_pattern.find(device_address) == stats->Write_address_access_pattern.end())
 				{
 					Utils::Address_Histogram_Unit hist;
 					hist.Access_count = 1;
 					hist.Accessed_sub_units = access_status_bitmap;
-					stats.Write_address_access_pattern[device_address] = hist;
+					stats->Write_address_access_pattern[device_address] = hist;
 				}
 				else
 				{
-					stats.Write_address_access_pattern[device_address].Access_count = stats.Write_address_access_pattern[device_address].Access_count + 1;
-					stats.Write_address_access_pattern[device_address].Accessed_sub_units = stats.Write_address_access_pattern[device_address].Accessed_sub_units | access_status_bitmap;
+					stats->Write_address_access_pattern[device_address].Access_count = stats->Write_address_access_pattern[device_address].Access_count + 1;
+					stats->Write_address_access_pattern[device_address].Accessed_sub_units = stats->Write_address_access_pattern[device_address].Accessed_sub_units | access_status_bitmap;
 				}
 
-				if (stats.Read_address_access_pattern.find(device_address) != stats.Read_address_access_pattern.end())
+				if (stats->Read_address_access_pattern.find(device_address) != stats->Read_address_access_pattern.end())
 				{
-					stats.Write_read_shared_addresses.insert(device_address);
+					stats->Write_read_shared_addresses.insert(device_address);
 				}
 			}
 			else
 			{
-				if (stats.Read_address_access_pattern.find(device_address) == stats.Read_address_access_pattern.end())
+				if (stats->Read_address_access_pattern.find(device_address) == stats->Read_address_access_pattern.end())
 				{
 					Utils::Address_Histogram_Unit hist;
 					hist.Access_count = 1;
 					hist.Accessed_sub_units = access_status_bitmap;
-					stats.Read_address_access_pattern[device_address] = hist;
+					stats->Read_address_access_pattern[device_address] = hist;
 				}
 				else
 				{
-					stats.Read_address_access_pattern[device_address].Access_count = stats.Read_address_access_pattern[device_address].Access_count + 1;
-					stats.Read_address_access_pattern[device_address].Accessed_sub_units = stats.Read_address_access_pattern[device_address].Accessed_sub_units | access_status_bitmap;
+					stats->Read_address_access_pattern[device_address].Access_count = stats->Read_address_access_pattern[device_address].Access_count + 1;
+					stats->Read_address_access_pattern[device_address].Accessed_sub_units = stats->Read_address_access_pattern[device_address].Accessed_sub_units | access_status_bitmap;
 				}
 
-				if (stats.Write_address_access_pattern.find(device_address) != stats.Write_address_access_pattern.end())
+				if (stats->Write_address_access_pattern.find(device_address) != stats->Write_address_access_pattern.end())
 				{
-					stats.Write_read_shared_addresses.insert(device_address);
+					stats->Write_read_shared_addresses.insert(device_address);
 				}
 			}
-			stats.Total_accessed_lbas++;
+			stats->Total_accessed_lbas++;
 			start_LBA++;
 			if (start_LBA > end_lsa_on_device)
 			{
@@ -286,53 +351,251 @@ void IO_Flow_Trace_Based::Get_statistics(Utils::Workload_Statistics &stats, LPA_
 		}
 
 		//Request size statistics
-		if (line_splitted[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0)
+		if (record.Type == Host_IO_Request_Type::WRITE)
 		{
 			if (diff < MAX_ARRIVAL_TIME_HISTOGRAM)
 			{
-				stats.Write_arrival_time[diff]++;
+				stats->Write_arrival_time[diff]++;
 			}
 			else
 			{
-				stats.Write_arrival_time[MAX_ARRIVAL_TIME_HISTOGRAM]++;
+				stats->Write_arrival_time[MAX_ARRIVAL_TIME_HISTOGRAM]++;
 			}
 
 			if (LBA_count < MAX_REQSIZE_HISTOGRAM_ITEMS)
 			{
-				stats.Write_size_histogram[LBA_count]++;
+				stats->Write_size_histogram[LBA_count]++;
 			}
 			else
 			{
-				stats.Write_size_histogram[MAX_REQSIZE_HISTOGRAM_ITEMS]++;
+				stats->Write_size_histogram[MAX_REQSIZE_HISTOGRAM_ITEMS]++;
 			}
 		}
 		else
 		{
 			if (diff < MAX_ARRIVAL_TIME_HISTOGRAM)
 			{
-				stats.Read_arrival_time[diff]++;
+				stats->Read_arrival_time[diff]++;
 			}
 			else
 			{
-				stats.Read_arrival_time[MAX_ARRIVAL_TIME_HISTOGRAM]++;
+				stats->Read_arrival_time[MAX_ARRIVAL_TIME_HISTOGRAM]++;
 			}
 
 			if (LBA_count < MAX_REQSIZE_HISTOGRAM_ITEMS)
 			{
-				stats.Read_size_histogram[LBA_count]++;
+				stats->Read_size_histogram[LBA_count]++;
 			}
 			else
 			{
-				stats.Read_size_histogram[(unsigned int)MAX_REQSIZE_HISTOGRAM_ITEMS]++;
+				stats->Read_size_histogram[(unsigned int)MAX_REQSIZE_HISTOGRAM_ITEMS]++;
 			}
 		}
-		stats.Total_generated_requests++;
+		stats->Total_generated_requests++;
+	}
+	if (trace_reader_temp->Get_discard_record_count() > 0 || trace_reader_temp->Get_flush_record_count() > 0)
+	{
+		std::cout << "Trace file: " << trace_file_path << " has " << trace_reader_temp->Get_discard_record_count() << " discard and "
+				  << trace_reader_temp->Get_flush_record_count() << " flush records, which are not executed" << std::endl;
+	}
+	trace_reader_temp->Close();
+	delete trace_reader_temp;
+	trace_ingested = true;
+	PRINT_MESSAGE("Trace file: " << trace_file_path << " seems healthy");
+	if (stats == NULL)
+	{
+		return;
 	}
-	trace_file_temp.close();
-	stats.Average_request_size_sector = (unsigned int)(sum_request_size / stats.Total_generated_requests);
-	stats.Average_inter_arrival_time_nano_sec = sum_inter_arrival / stats.Total_generated_requests;
 
-	stats.Initial_occupancy_ratio = initial_occupancy_ratio;
-	stats.Replay_no = total_replay_no;
+	stats->Average_request_size_sector = (unsigned int)(sum_request_size / stats->Total_generated_requests);
+	stats->Average_inter_arrival_time_nano_sec = sum_inter_arrival / stats->Total_generated_requests;
+}
+
+bool IO_Flow_Trace_Based::get_trace_statistics_key(uint64_t &key)
+{
+	std::string trace_version;
+	if (!Utils::Get_file_version(trace_file_path, trace_version))
+	{
+		return false;
+	}
+	key = Utils::Hash_string(trace_version + " " + std::to_string((int)trace_file_format) + " " + std::to_string(sampling_parameters.Load_scaling_factor)
+		+ " " + std::to_string(sampling_parameters.Window_start) + " " + std::to_string(sampling_parameters.Window_end)
+		+ " " + std::to_string(sampling_parameters.Sampling_period) + " " + std::to_string(sampling_parameters.Sampling_length));
+
+	return true;
+}
+
+template <typename T>
+static void save_histogram(Utils::Checkpoint_Writer &writer, const std::vector<T> &histogram)
+{
+	//The histograms are mostly empty, so only the non-zero bins are stored
+	uint64_t count = 0;
+	for (auto bin : histogram)
+	{
+		if (bin != 0)
+		{
+			count++;
+		}
+	}
+	writer.Write(count);
+	for (uint64_t i = 0; i < histogram.size(); i++)
+	{
+		if (histogram[i] != 0)
+		{
+			writer.Write(i);
+			writer.Write(histogram[i]);
+		}
+	}
+}
+
+template <typename T>
+static void load_histogram(Utils::Checkpoint_Reader &reader, std::vector<T> &histogram)
+{
+	uint64_t count;
+	reader.Read(count);
+	for (uint64_t i = 0; i < count; i++)
+	{
+		uint64_t bin;
+		reader.Read(bin);
+		if (bin >= histogram.size())
+		{
+			PRINT_ERROR("The trace statistics file is corrupted")
+		}
+		reader.Read(histogram[bin]);
+	}
+}
+
+static void save_address_access_pattern(Utils::Checkpoint_Writer &writer, const std::map<LPA_type, Utils::Address_Histogram_Unit> &pattern)
+{
+	writer.Write((uint64_t)pattern.size());
+	for (auto &entry : pattern)
+	{
+		writer.Write(entry.first);
+		writer.Write(entry.second);
+	}
+}
+
+static void load_address_access_pattern(Utils::Checkpoint_Reader &reader, std::map<LPA_type, Utils::Address_Histogram_Unit> &pattern)
+{
+	uint64_t count;
+	reader.Read(count);
+	for (uint64_t i = 0; i < count; i++)
+	{
+		LPA_type address;
+		Utils::Address_Histogram_Unit unit;
+		reader.Read(address);
+		reader.Read(unit);
+		pattern.insert(pattern.end(), std::make_pair(address, unit));
+	}
+}
+
+/*
+* The sidecar file stores the request count of the trace and, once they are computed for preconditioning, its
+* workload statistics. The statistics also depend on the address range of the flow and on how the SSD maps host
+* addresses to pages, so they are only used if the address of the last LHA of the range is the same as when they
+* were computed.
+*/
+bool IO_Flow_Trace_Based::load_trace_statistics(Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+												page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha))
+{
+	uint64_t key;
+	Utils::Checkpoint_Reader reader;
+	if (!get_trace_statistics_key(key) || !reader.Open(trace_file_path + TRACE_STATISTICS_FILE_SUFFIX, key))
+	{
+		return false;
+	}
+
+	uint64_t request_count;
+	bool has_statistics;
+	reader.Read(request_count);
+	reader.Read(has_statistics);
+	if (stats != NULL)
+	{
+		LHA_type start_lsa, end_lsa;
+		LPA_type last_address;
+		page_status_type last_address_bitmap;
+		if (!has_statistics)
+		{
+			reader.Close();
+			return false;
+		}
+		reader.Read(start_lsa);
+		reader.Read(end_lsa);
+		reader.Read(last_address);
+		reader.Read(last_address_bitmap);
+		if (start_lsa != start_lsa_on_device || end_lsa != end_lsa_on_device
+			|| last_address != Convert_host_logical_address_to_device_address(end_lsa_on_device)
+			|| last_address_bitmap != Find_NVM_subunit_access_bitmap(end_lsa_on_device))
+		{
+			reader.Close();
+			return false;
+		}
+		load_histogram(reader, stats->Write_arrival_time);
+		load_histogram(reader, stats->Read_arrival_time);
+		load_histogram(reader, stats->Write_size_histogram);
+		load_histogram(reader, stats->Read_size_histogram);
+		load_address_access_pattern(reader, stats->Write_address_access_pattern);
+		load_address_access_pattern(reader, stats->Read_address_access_pattern);
+		uint64_t count;
+		reader.Read(count);
+		for (uint64_t i = 0; i < count; i++)
+		{
+			LPA_type address;
+			reader.Read(address);
+			stats->Write_read_shared_addresses.insert(stats->Write_read_shared_addresses.end(), address);
+		}
+		reader.Read(stats->Total_generated_requests);
+		reader.Read(stats->Total_accessed_lbas);
+		reader.Read(stats->Average_request_size_sector);
+		reader.Read(stats->Average_inter_arrival_time_nano_sec);
+	}
+	reader.Close();
+	total_requests_in_file = (unsigned int)request_count;
+	trace_ingested = true;
+	std::cout << "Using the statistics of the input trace file from " << trace_file_path << TRACE_STATISTICS_FILE_SUFFIX << std::endl;
+
+	return true;
+}
+
+void IO_Flow_Trace_Based::save_trace_statistics(const Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+												page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha))
+{
+	uint64_t key;
+	Utils::Checkpoint_Writer writer;
+	if (!get_trace_statistics_key(key) || !writer.Open(trace_file_path + TRACE_STATISTICS_FILE_SUFFIX, key))
+	{
+		std::cerr << "Warning: unable to create the trace statistics file " << trace_file_path << TRACE_STATISTICS_FILE_SUFFIX << ", the statistics are not cached" << std::endl;
+		return;
+	}
+
+	writer.Write((uint64_t)total_requests_in_file);
+	writer.Write(stats != NULL);
+	if (stats != NULL)
+	{
+		writer.Write(start_lsa_on_device);
+		writer.Write(end_lsa_on_device);
+		writer.Write(Convert_host_logical_address_to_device_address(end_lsa_on_device));
+		writer.Write(Find_NVM_subunit_access_bitmap(end_lsa_on_device));
+		save_histogram(writer, stats->Write_arrival_time);
+		save_histogram(writer, stats->Read_arrival_time);
+		save_histogram(writer, stats->Write_size_histogram);
+		save_histogram(writer, stats->Read_size_histogram);
+		save_address_access_pattern(writer, stats->Write_address_access_pattern);
+		save_address_access_pattern(writer, stats->Read_address_access_pattern);
+		writer.Write((uint64_t)stats->Write_read_shared_addresses.size());
+		for (auto address : stats->Write_read_shared_addresses)
+		{
+			writer.Write(address);
+		}
+		writer.Write(stats->Total_generated_requests);
+		writer.Write(stats->Total_accessed_lbas);
+		writer.Write(stats->Average_request_size_sector);
+		writer.Write(stats->Average_inter_arrival_time_nano_sec);
+	}
+	//The statistics are only a cache, so the simulation goes on without them
+	if (!writer.Close())
+	{
+		std::cerr << "Warning: unable to write the trace statistics file " << trace_file_path << TRACE_STATISTICS_FILE_SUFFIX << ", the statistics are not cached" << std::endl;
+	}
 }
-} // namespace Host_Components
\ No newline at end of file
+} // namespace Host_Components
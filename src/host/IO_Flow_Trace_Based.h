@@ -6,6 +6,14 @@
 #include <fstream>
 #include "IO_Flow_Base.h"
 #include "ASCII_Trace_Definition.h"
+#include "Trace_Reader.h"
+#include "Trace_Prefetcher.h"
+
+#define TRACE_STATISTICS_FILE_SUFFIX ".stats"
+#define TRACE_THINK_TIME_EVENT 1 //A closed-loop slot is released after its think time
+
+//TIMESTAMP replays the requests at their arrival times, QUEUE_DEPTH ignores them and keeps a fixed number of requests outstanding
+enum class Trace_Replay_Mode { TIMESTAMP, QUEUE_DEPTH };
 
 namespace Host_Components
 {
@@ -14,7 +22,8 @@ class IO_Flow_Trace_Based : public IO_Flow_Base
 public:
 	IO_Flow_Trace_Based(const sim_object_id_type &name, uint16_t flow_id, LHA_type start_lsa_on_device, LHA_type end_lsa_on_device, uint16_t io_queue_id,
 						uint16_t nvme_submission_queue_size, uint16_t nvme_completion_queue_size, IO_Flow_Priority_Class::Priority priority_class, double initial_occupancy_ratio,
-						std::string trace_file_path, Trace_Time_Unit time_unit, unsigned int total_replay_count, unsigned int percentage_to_be_simulated,
+						std::string trace_file_path, Trace_File_Format trace_file_format, Trace_Time_Unit time_unit, unsigned int total_replay_count, unsigned int percentage_to_be_simulated,
+						const Trace_Sampling_Parameters &sampling_parameters, Trace_Replay_Mode replay_mode, unsigned int queue_depth, sim_time_type think_time,
 						HostInterface_Types SSD_device_type, PCIe_Root_Complex *pcie_root_complex, SATA_HBA *sata_hba,
 						bool enabled_logging, sim_time_type logging_period, std::string logging_file_path);
 	~IO_Flow_Trace_Based();
@@ -29,13 +38,30 @@ public:
 
 private:
 	std::string trace_file_path;
+	Trace_File_Format trace_file_format;
 	Trace_Time_Unit time_unit;
 	unsigned int percentage_to_be_simulated;
-	std::ifstream trace_file;
-	unsigned int total_replay_no, replay_counter;
+	Trace_Sampling_Parameters sampling_parameters;
+	Trace_Replay_Mode replay_mode;
+	unsigned int queue_depth;//The number of outstanding requests in the QUEUE_DEPTH mode
+	sim_time_type think_time;//The delay between the completion of a request and the submission of the next one in the QUEUE_DEPTH mode
+	Trace_Reader *trace_reader;
+	Trace_Prefetcher *trace_prefetcher;
+	unsigned int total_replay_no;
 	unsigned int total_requests_in_file;
-	std::vector<std::string> current_trace_line;
-	sim_time_type time_offset;
+	Trace_Request_Descriptor current_request;
+	bool has_current_request;
+	bool trace_ingested;//total_requests_in_file is known
+	Trace_Reader *create_trace_reader();
+	void submit_next_request();
+	void request_completed();
+	void ingest_trace(Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+					  page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha));
+	bool get_trace_statistics_key(uint64_t &key);
+	bool load_trace_statistics(Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+							   page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha));
+	void save_trace_statistics(const Utils::Workload_Statistics *stats, LPA_type (*Convert_host_logical_address_to_device_address)(LHA_type lha),
+							   page_status_type (*Find_NVM_subunit_access_bitmap)(LHA_type lha));
 };
 } // namespace Host_Components
 
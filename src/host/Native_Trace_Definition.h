@@ -0,0 +1,48 @@
+#ifndef NATIVE_TRACE_DEFINITION_H
+#define NATIVE_TRACE_DEFINITION_H
+
+/*
+* The trace formats of other tools that MQSim parses directly, without converting them into its own
+* ASCII format first. Their arrival times are converted to nanoseconds relative to the first request,
+* and their byte addresses and sizes to 512-byte sectors.
+*/
+enum class Trace_File_Format { MQSIM, BLKPARSE, MSR_CAMBRIDGE, FIO_IOLOG };
+
+//blkparse default output: "major,minor cpu sequence seconds.nanoseconds pid action RWBS sector + sector_count [process]"
+#define BlkparseDeviceColumn 0
+#define BlkparseTimeColumn 3
+#define BlkparseActionColumn 5
+#define BlkparseRWBSColumn 6
+#define BlkparseSectorColumn 7
+#define BlkparseSizeColumn 9
+#define BlkparseItemsPerLine 10
+#define BlkparseIssueAction "D" //Requests are replayed when they are issued to the driver, i.e., after merging and splitting in the block layer
+#define BlkparseWriteCode 'W'
+#define BlkparseReadCode 'R'
+#define BlkparseDiscardCode 'D'
+#define BlkparseFlushCode 'F' //A leading F is a preflush, an F after the data direction is FUA
+
+//SNIA MSR-Cambridge: "Timestamp,Hostname,DiskNumber,Type,Offset,Size,ResponseTime", with Windows filetime timestamps
+#define MSRTraceTimeColumn 0
+#define MSRTraceDeviceColumn 2
+#define MSRTraceTypeColumn 3
+#define MSRTraceOffsetColumn 4
+#define MSRTraceSizeColumn 5
+#define MSRTraceItemsPerLine 7
+#define MSRTraceTimeUnit 100 //Nanoseconds per filetime tick
+#define MSRTraceWriteCode "Write"
+#define MSRTraceReadCode "Read"
+#define MSRLineDelimiter ','
+
+//fio iolog: a version line followed by "[timestamp] file_name action [offset length]" lines, where timestamp is only present in version 3
+#define FioIologVersion2Header "fio version 2 iolog"
+#define FioIologVersion3Header "fio version 3 iolog"
+#define FioIologTimeUnit 1000 //Nanoseconds per microsecond, the unit of v3 timestamps and v2 wait actions
+#define FioIologWriteAction "write"
+#define FioIologReadAction "read"
+#define FioIologTrimAction "trim"
+#define FioIologSyncAction "sync"
+#define FioIologDataSyncAction "datasync"
+#define FioIologWaitAction "wait"
+
+#endif // !NATIVE_TRACE_DEFINITION_H
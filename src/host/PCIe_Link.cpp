@@ -33,14 +33,14 @@ namespace Host_Components
 				if (Message_buffer_toward_root_complex.size() > 1) {//There are active transfers
 					return;
 				}
-				Simulator->Register_sim_event(Simulator->Time() + estimate_transfer_time(message), this, (void*)(intptr_t)PCIe_Destination_Type::HOST, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_transfer_time(message), this, PCIe_Destination_Type::HOST, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
 				break;
 			case PCIe_Destination_Type::DEVICE://Message from Host to the SSD device
 				Message_buffer_toward_ssd_device.push(message);
 				if (Message_buffer_toward_ssd_device.size() > 1) {
 					return;
 				}
-				Simulator->Register_sim_event(Simulator->Time() + estimate_transfer_time(message), this, (void*)(intptr_t)PCIe_Destination_Type::DEVICE, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_transfer_time(message), this, PCIe_Destination_Type::DEVICE, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
 				break;
 			default:
 				break;
@@ -54,15 +54,15 @@ namespace Host_Components
 	void PCIe_Link::Execute_simulator_event(MQSimEngine::Sim_Event* event)
 	{
 		PCIe_Message* message = NULL;
-		PCIe_Destination_Type destination = (PCIe_Destination_Type)(intptr_t)event->Parameters;
+		PCIe_Destination_Type destination = event->Get_payload<PCIe_Destination_Type>();
 		switch (destination) {
 			case PCIe_Destination_Type::HOST:
 				message = Message_buffer_toward_root_complex.front();
 				Message_buffer_toward_root_complex.pop();
 				root_complex->Consume_pcie_message(message);
 				if (Message_buffer_toward_root_complex.size() > 0) {//There are active transfers
-					Simulator->Register_sim_event(Simulator->Time() + estimate_transfer_time(Message_buffer_toward_root_complex.front()),
-						this, (void*)(intptr_t)PCIe_Destination_Type::HOST, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_transfer_time(Message_buffer_toward_root_complex.front()),
+						this, PCIe_Destination_Type::HOST, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
 				}
 				break;
 			case PCIe_Destination_Type::DEVICE:
@@ -70,8 +70,8 @@ namespace Host_Components
 				Message_buffer_toward_ssd_device.pop();
 				pcie_switch->Deliver_to_device(message);
 				if (Message_buffer_toward_ssd_device.size() > 0) {
-					Simulator->Register_sim_event(Simulator->Time() + estimate_transfer_time(Message_buffer_toward_ssd_device.front()),
-						this, (void*)(intptr_t)PCIe_Destination_Type::DEVICE, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_transfer_time(Message_buffer_toward_ssd_device.front()),
+						this, PCIe_Destination_Type::DEVICE, static_cast<int>(PCIe_Link_Event_Type::DELIVER));
 				}
 				break;
 		}
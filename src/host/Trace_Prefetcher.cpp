@@ -0,0 +1,80 @@
+#include <chrono>
+#include "Trace_Prefetcher.h"
+
+namespace Host_Components
+{
+	Trace_Prefetcher::Trace_Prefetcher(Trace_Reader* trace_reader, unsigned int total_request_count, unsigned int total_replay_no,
+		LHA_type start_lsa_on_device, LHA_type end_lsa_on_device) :
+		trace_reader(trace_reader), total_request_count(total_request_count), total_replay_no(total_replay_no), replay_counter(0),
+		start_lsa_on_device(start_lsa_on_device), end_lsa_on_device(end_lsa_on_device), buffer(TRACE_PREFETCH_BUFFER_SIZE),
+		finished(false), stop_requested(false)
+	{
+	}
+
+	Trace_Prefetcher::~Trace_Prefetcher()
+	{
+		stop_requested.store(true, std::memory_order_release);
+		if (reader_thread.joinable()) {
+			reader_thread.join();
+		}
+	}
+
+	void Trace_Prefetcher::Start()
+	{
+		reader_thread = std::thread(&Trace_Prefetcher::run, this);
+	}
+
+	bool Trace_Prefetcher::Next(Trace_Request_Descriptor& request)
+	{
+		if (buffer.Pop(request)) {
+			return true;
+		}
+
+		//The reader thread fell behind, e.g., on slow disk I/O
+		request_available.Wait([this]() {
+			return buffer.Front() != NULL || finished.load(std::memory_order_acquire);
+		});
+		//The last requests may have been pushed right before finished was set
+		return buffer.Pop(request);
+	}
+
+	void Trace_Prefetcher::run()
+	{
+		Trace_Record record;
+		Trace_Request_Descriptor request;
+		sim_time_type time_offset = 0, last_event_time = 0;
+		for (unsigned int produced = 0; produced < total_request_count; produced++) {
+			if (!trace_reader->Read_next(record)) {
+				trace_reader->Rewind();
+				replay_counter++;
+				time_offset = last_event_time;
+				if (!trace_reader->Read_next(record)) {
+					break;
+				}
+				PRINT_MESSAGE("* Replay round " << replay_counter << " of " << total_replay_no << " started");
+			}
+
+			request.Event_time = time_offset + record.Arrival_time;
+			request.Time_offset = time_offset;
+			request.LBA_count = record.LBA_count;
+			request.Type = record.Type;
+			request.Start_LBA = record.Start_LBA;
+			if (request.Start_LBA <= (end_lsa_on_device - start_lsa_on_device)) {
+				request.Start_LBA += start_lsa_on_device;
+			} else {
+				request.Start_LBA = start_lsa_on_device + request.Start_LBA % (end_lsa_on_device - start_lsa_on_device);
+			}
+			last_event_time = request.Event_time;
+
+			while (!buffer.Push(request)) {
+				if (stop_requested.load(std::memory_order_acquire)) {
+					return;
+				}
+				std::this_thread::sleep_for(std::chrono::microseconds(TRACE_PREFETCH_WAIT_US));
+			}
+			request_available.Notify();
+		}
+		finished.store(true, std::memory_order_release);
+		request_available.Notify();
+	}
+}
@@ -0,0 +1,57 @@
+#ifndef TRACE_PREFETCHER_H
+#define TRACE_PREFETCHER_H
+
+#include <atomic>
+#include <thread>
+#include "../sim/Sim_Defs.h"
+#include "../ssd/SSD_Defs.h"
+#include "../utils/Spsc_Ring.h"
+#include "../utils/Thread_Waiter.h"
+#include "Host_IO_Request.h"
+#include "Trace_Reader.h"
+
+#define TRACE_PREFETCH_BUFFER_SIZE 8192 //Must be a power of two
+#define TRACE_PREFETCH_WAIT_US 50 //How long the reader thread sleeps when the buffer is full
+
+namespace Host_Components
+{
+	//A trace request that is ready to be submitted, with its address already mapped into the address range of the flow
+	struct Trace_Request_Descriptor
+	{
+		sim_time_type Event_time;//The time_offset of the replay round plus the arrival time in the trace
+		sim_time_type Time_offset;
+		LHA_type Start_LBA;
+		unsigned int LBA_count;
+		Host_IO_Request_Type Type;
+	};
+
+	/*
+	* Decodes the requests of a trace on a reader thread, ahead of the simulation, into a bounded lock-free
+	* buffer. The reader thread also replays the trace: at the end of the file it rewinds the reader and
+	* shifts the arrival times of the next round by the arrival time of the last request of the current
+	* round, so the simulation thread never touches the trace file.
+	*/
+	class Trace_Prefetcher
+	{
+	public:
+		Trace_Prefetcher(Trace_Reader* trace_reader, unsigned int total_request_count, unsigned int total_replay_no,
+			LHA_type start_lsa_on_device, LHA_type end_lsa_on_device);
+		~Trace_Prefetcher();
+		void Start();
+		bool Next(Trace_Request_Descriptor& request);//Returns false once all the requests are consumed
+	private:
+		Trace_Reader* trace_reader;
+		unsigned int total_request_count;
+		unsigned int total_replay_no;
+		unsigned int replay_counter;
+		LHA_type start_lsa_on_device, end_lsa_on_device;
+		Utils::Spsc_Ring<Trace_Request_Descriptor> buffer;
+		std::atomic<bool> finished;//All the requests are in the buffer
+		std::atomic<bool> stop_requested;
+		Utils::Thread_Waiter request_available;//Wakes up the simulation thread when it waits for the reader thread
+		std::thread reader_thread;
+		void run();
+	};
+}
+
+#endif // !TRACE_PREFETCHER_H
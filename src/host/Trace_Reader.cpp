@@ -0,0 +1,535 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include "Trace_Reader.h"
+#include "../utils/StringTools.h"
+
+namespace Host_Components
+{
+	Trace_Reader* Trace_Reader::Create(const std::string& file_path, Trace_File_Format format)
+	{
+		switch (format) {
+			case Trace_File_Format::BLKPARSE:
+				return new Blkparse_Trace_Reader;
+			case Trace_File_Format::MSR_CAMBRIDGE:
+				return new MSR_Cambridge_Trace_Reader;
+			case Trace_File_Format::FIO_IOLOG:
+				return new Fio_Iolog_Trace_Reader;
+			default:
+				break;
+		}
+
+		uint64_t magic = 0;
+		std::ifstream trace_file(file_path, std::ios::binary);
+		trace_file.read((char*)&magic, sizeof(magic));
+		if (trace_file.good() && magic == BinaryTraceMagic) {
+			return new Binary_Trace_Reader;
+		}
+
+		return new ASCII_Trace_Reader;
+	}
+
+	bool ASCII_Trace_Reader::Open(const std::string& file_path)
+	{
+		this->file_path = file_path;
+		trace_file.open(file_path, std::ios::in);
+
+		return trace_file.is_open();
+	}
+
+	bool ASCII_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		if (!std::getline(trace_file, trace_line) || trace_line.size() == 0) {
+			return false;
+		}
+		Utils::Helper_Functions::Remove_cr(trace_line);
+		line_splitted.clear();
+		Utils::Helper_Functions::Tokenize(trace_line, ASCIILineDelimiter, line_splitted);
+		if (line_splitted.size() != ASCIIItemsPerLine) {
+			return false;
+		}
+
+		char* pEnd;
+		record.Arrival_time = std::strtoull(line_splitted[ASCIITraceTimeColumn].c_str(), &pEnd, 10);
+		record.Device = std::strtoul(line_splitted[ASCIITraceDeviceColumn].c_str(), &pEnd, 10);
+		record.Start_LBA = std::strtoull(line_splitted[ASCIITraceAddressColumn].c_str(), &pEnd, 0);
+		record.LBA_count = std::strtoul(line_splitted[ASCIITraceSizeColumn].c_str(), &pEnd, 0);
+		record.Type = line_splitted[ASCIITraceTypeColumn].compare(ASCIITraceWriteCode) == 0 ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+
+		return true;
+	}
+
+	void ASCII_Trace_Reader::Rewind()
+	{
+		trace_file.close();
+		trace_file.open(file_path, std::ios::in);
+	}
+
+	void ASCII_Trace_Reader::Close()
+	{
+		trace_file.close();
+	}
+
+	Binary_Trace_Reader::Binary_Trace_Reader() : mapped_file(NULL), mapped_size(0), records(NULL), record_count(0), next_record(0)
+#ifdef _WIN32
+		, file_handle(NULL), mapping_handle(NULL)
+#endif
+	{
+	}
+
+	Binary_Trace_Reader::~Binary_Trace_Reader()
+	{
+		Close();
+	}
+
+	bool Binary_Trace_Reader::Open(const std::string& file_path)
+	{
+		Close();
+#ifdef _WIN32
+		file_handle = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (file_handle == INVALID_HANDLE_VALUE) {
+			file_handle = NULL;
+			return false;
+		}
+		LARGE_INTEGER file_size;
+		GetFileSizeEx(file_handle, &file_size);
+		mapped_size = (uint64_t)file_size.QuadPart;
+		if (mapped_size >= sizeof(Binary_Trace_Header)) {
+			mapping_handle = CreateFileMappingA(file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (mapping_handle != NULL) {
+				mapped_file = (const char*)MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+			}
+		}
+#else
+		int fd = open(file_path.c_str(), O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat file_status;
+		if (fstat(fd, &file_status) == 0 && (uint64_t)file_status.st_size >= sizeof(Binary_Trace_Header)) {
+			mapped_size = (uint64_t)file_status.st_size;
+			void* address = mmap(NULL, mapped_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (address != MAP_FAILED) {
+				mapped_file = (const char*)address;
+				madvise(address, mapped_size, MADV_SEQUENTIAL);
+			}
+		}
+		close(fd);//The mapping stays valid after closing the file descriptor
+#endif
+		if (mapped_file == NULL) {
+			Close();
+			return false;
+		}
+
+		const Binary_Trace_Header* header = (const Binary_Trace_Header*)mapped_file;
+		if (header->Magic != BinaryTraceMagic || header->Version != BinaryTraceVersion || header->Record_size != sizeof(Binary_Trace_Record)
+			|| header->Record_count > (mapped_size - sizeof(Binary_Trace_Header)) / sizeof(Binary_Trace_Record)) {
+			Close();
+			return false;
+		}
+		records = (const Binary_Trace_Record*)(mapped_file + sizeof(Binary_Trace_Header));
+		record_count = header->Record_count;
+		next_record = 0;
+
+		return true;
+	}
+
+	bool Binary_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		if (next_record == record_count) {
+			return false;
+		}
+
+		const Binary_Trace_Record& binary_record = records[next_record++];
+		record.Arrival_time = binary_record.Time;
+		record.Device = binary_record.Device;
+		record.Start_LBA = binary_record.Start_LBA;
+		record.LBA_count = binary_record.LBA_count;
+		record.Type = binary_record.Type == BinaryTraceWriteCode ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+
+		return true;
+	}
+
+	void Binary_Trace_Reader::Rewind()
+	{
+		next_record = 0;
+	}
+
+	void Binary_Trace_Reader::Close()
+	{
+#ifdef _WIN32
+		if (mapped_file != NULL) {
+			UnmapViewOfFile(mapped_file);
+		}
+		if (mapping_handle != NULL) {
+			CloseHandle(mapping_handle);
+		}
+		if (file_handle != NULL) {
+			CloseHandle(file_handle);
+		}
+		mapping_handle = NULL;
+		file_handle = NULL;
+#else
+		if (mapped_file != NULL) {
+			munmap((void*)mapped_file, mapped_size);
+		}
+#endif
+		mapped_file = NULL;
+		mapped_size = 0;
+		records = NULL;
+		record_count = 0;
+		next_record = 0;
+	}
+
+	uint64_t Binary_Trace_Reader::Get_record_count() const
+	{
+		return record_count;
+	}
+
+	//Parses a non-negative decimal integer that spans the whole field
+	static bool parse_field(const std::string& field, uint64_t& value)
+	{
+		if (field.size() == 0 || field[0] < '0' || field[0] > '9') {
+			return false;
+		}
+		char* pEnd;
+		value = std::strtoull(field.c_str(), &pEnd, 10);
+
+		return *pEnd == '\0';
+	}
+
+	//Parses a "seconds.fraction" time into nanoseconds without going through floating point
+	static bool parse_seconds_field(const std::string& field, sim_time_type& time)
+	{
+		size_t point = field.find('.');
+		uint64_t seconds, fraction = 0;
+		if (!parse_field(field.substr(0, point), seconds)) {
+			return false;
+		}
+		if (point != std::string::npos) {
+			std::string fraction_digits = field.substr(point + 1, 9);
+			if (fraction_digits.size() > 0 && !parse_field(fraction_digits, fraction)) {
+				return false;
+			}
+			for (size_t digit = fraction_digits.size(); digit < 9; digit++) {
+				fraction *= 10;
+			}
+		}
+		time = seconds * NanoSecondCoeff + fraction;
+
+		return true;
+	}
+
+	bool Native_Trace_Reader::Open(const std::string& file_path)
+	{
+		this->file_path = file_path;
+		trace_file.open(file_path, std::ios::in);
+
+		return trace_file.is_open() && start();
+	}
+
+	void Native_Trace_Reader::Rewind()
+	{
+		trace_file.close();
+		trace_file.open(file_path, std::ios::in);
+		discard_record_count = 0;
+		flush_record_count = 0;
+		start();
+	}
+
+	void Native_Trace_Reader::Close()
+	{
+		trace_file.close();
+	}
+
+	bool Native_Trace_Reader::read_line(char delimiter)
+	{
+		const std::string delimiters = delimiter == ' ' ? " \t" : std::string(1, delimiter);
+		while (std::getline(trace_file, trace_line)) {
+			if (trace_line.size() > 0 && trace_line[trace_line.size() - 1] == '\r') {
+				trace_line.erase(trace_line.size() - 1, 1);
+			}
+			line_splitted.clear();
+			size_t field_start = 0;
+			while (field_start < trace_line.size()) {
+				size_t field_end = trace_line.find_first_of(delimiters, field_start);
+				if (field_end == std::string::npos) {
+					field_end = trace_line.size();
+				}
+				if (field_end > field_start || delimiter != ' ') {
+					line_splitted.push_back(trace_line.substr(field_start, field_end - field_start));
+				}
+				field_start = field_end + 1;
+			}
+			if (line_splitted.size() > 0) {
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool Blkparse_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		while (read_line(' ')) {
+			//Besides the other actions, this also skips the per-CPU summary that blkparse prints at the end
+			if (line_splitted.size() <= BlkparseRWBSColumn || line_splitted[BlkparseActionColumn] != BlkparseIssueAction) {
+				continue;
+			}
+			const std::string& device = line_splitted[BlkparseDeviceColumn];
+			size_t comma = device.find(',');
+			uint64_t minor;
+			sim_time_type time;
+			if (comma == std::string::npos || !parse_field(device.substr(comma + 1), minor)
+				|| !parse_seconds_field(line_splitted[BlkparseTimeColumn], time)) {
+				continue;
+			}
+
+			const std::string& rwbs = line_splitted[BlkparseRWBSColumn];
+			if (rwbs.find(BlkparseDiscardCode) != std::string::npos) {
+				discard_record_count++;
+				continue;
+			}
+			if (rwbs[0] == BlkparseFlushCode) {
+				flush_record_count++;//A preflush of a write is counted, and the write itself is replayed
+			}
+			bool is_write = rwbs.find(BlkparseWriteCode) != std::string::npos;
+			if (!is_write && rwbs.find(BlkparseReadCode) == std::string::npos) {
+				continue;
+			}
+			uint64_t sector, sector_count;
+			if (line_splitted.size() < BlkparseItemsPerLine || !parse_field(line_splitted[BlkparseSectorColumn], sector)
+				|| !parse_field(line_splitted[BlkparseSizeColumn], sector_count) || sector_count == 0) {
+				continue;
+			}
+
+			record.Arrival_time = time;
+			record.Device = (unsigned int)minor;
+			record.Start_LBA = sector;
+			record.LBA_count = (unsigned int)sector_count;
+			record.Type = is_write ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool MSR_Cambridge_Trace_Reader::start()
+	{
+		first_record_read = false;
+		first_timestamp = 0;
+
+		return true;
+	}
+
+	bool MSR_Cambridge_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		while (read_line(MSRLineDelimiter)) {
+			uint64_t timestamp, device, offset, size;
+			if (line_splitted.size() != MSRTraceItemsPerLine || !parse_field(line_splitted[MSRTraceTimeColumn], timestamp)
+				|| !parse_field(line_splitted[MSRTraceDeviceColumn], device) || !parse_field(line_splitted[MSRTraceOffsetColumn], offset)
+				|| !parse_field(line_splitted[MSRTraceSizeColumn], size) || size == 0) {
+				continue;
+			}
+			const std::string& type = line_splitted[MSRTraceTypeColumn];
+			if (type != MSRTraceWriteCode && type != MSRTraceReadCode) {
+				continue;
+			}
+
+			if (!first_record_read) {
+				first_timestamp = timestamp;
+				first_record_read = true;
+			}
+			record.Arrival_time = timestamp < first_timestamp ? 0 : (timestamp - first_timestamp) * MSRTraceTimeUnit;
+			record.Device = (unsigned int)device;
+			record.Start_LBA = offset / SECTOR_SIZE_IN_BYTE;
+			record.LBA_count = (unsigned int)((offset + size + SECTOR_SIZE_IN_BYTE - 1) / SECTOR_SIZE_IN_BYTE - record.Start_LBA);
+			record.Type = type == MSRTraceWriteCode ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+			return true;
+		}
+
+		return false;
+	}
+
+	bool Fio_Iolog_Trace_Reader::start()
+	{
+		current_time = 0;
+		file_names.clear();
+		if (!std::getline(trace_file, trace_line)) {
+			return false;
+		}
+		Utils::Helper_Functions::Remove_cr(trace_line);
+		if (trace_line == FioIologVersion2Header) {
+			has_timestamps = false;
+		} else if (trace_line == FioIologVersion3Header) {
+			has_timestamps = true;
+		} else {
+			return false;
+		}
+
+		return true;
+	}
+
+	bool Fio_Iolog_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		const size_t action_column = has_timestamps ? 2 : 1;
+		while (read_line(' ')) {
+			if (line_splitted.size() <= action_column) {
+				continue;
+			}
+			sim_time_type time = current_time;
+			if (has_timestamps) {
+				uint64_t timestamp;
+				if (!parse_field(line_splitted[0], timestamp)) {
+					continue;
+				}
+				time = timestamp * FioIologTimeUnit;
+			}
+
+			//The file management actions (add, open and close) are skipped
+			const std::string& action = line_splitted[action_column];
+			uint64_t offset = 0, length = 0;
+			bool has_offset = line_splitted.size() > action_column + 1 && parse_field(line_splitted[action_column + 1], offset);
+			bool has_range = has_offset && line_splitted.size() > action_column + 2 && parse_field(line_splitted[action_column + 2], length);
+			if (action == FioIologWaitAction) {
+				if (!has_timestamps && has_offset) {
+					current_time += offset * FioIologTimeUnit;//A version 2 wait action stores its delay in the offset field
+				}
+				continue;
+			}
+			if (action == FioIologTrimAction) {
+				discard_record_count++;
+				continue;
+			}
+			if (action == FioIologSyncAction || action == FioIologDataSyncAction) {
+				flush_record_count++;
+				continue;
+			}
+			if ((action != FioIologWriteAction && action != FioIologReadAction) || !has_range || length == 0) {
+				continue;
+			}
+
+			const std::string& file_name = line_splitted[action_column - 1];
+			auto file = std::find(file_names.begin(), file_names.end(), file_name);
+			if (file == file_names.end()) {
+				file = file_names.insert(file_names.end(), file_name);
+			}
+			record.Arrival_time = time;
+			record.Device = (unsigned int)(file - file_names.begin());
+			record.Start_LBA = offset / SECTOR_SIZE_IN_BYTE;
+			record.LBA_count = (unsigned int)((offset + length + SECTOR_SIZE_IN_BYTE - 1) / SECTOR_SIZE_IN_BYTE - record.Start_LBA);
+			record.Type = action == FioIologWriteAction ? Host_IO_Request_Type::WRITE : Host_IO_Request_Type::READ;
+			return true;
+		}
+
+		return false;
+	}
+
+	Sampling_Trace_Reader::Sampling_Trace_Reader(Trace_Reader* trace_reader, const Trace_Sampling_Parameters& parameters) :
+		trace_reader(trace_reader), parameters(parameters)
+	{
+	}
+
+	Sampling_Trace_Reader::~Sampling_Trace_Reader()
+	{
+		delete trace_reader;
+	}
+
+	bool Sampling_Trace_Reader::Open(const std::string& file_path)
+	{
+		return trace_reader->Open(file_path);
+	}
+
+	bool Sampling_Trace_Reader::Read_next(Trace_Record& record)
+	{
+		while (trace_reader->Read_next(record)) {
+			discard_record_count = trace_reader->Get_discard_record_count();
+			flush_record_count = trace_reader->Get_flush_record_count();
+			if (record.Arrival_time < parameters.Window_start) {
+				continue;
+			}
+			if (parameters.Window_end != 0 && record.Arrival_time >= parameters.Window_end) {
+				return false;//The arrival times are monotonic, so the rest of the trace is outside the window
+			}
+
+			sim_time_type time = record.Arrival_time - parameters.Window_start;
+			if (parameters.Sampling_period != 0) {
+				if (time % parameters.Sampling_period >= parameters.Sampling_length) {
+					continue;
+				}
+				time = (time / parameters.Sampling_period) * parameters.Sampling_length + time % parameters.Sampling_period;
+			}
+			if (parameters.Load_scaling_factor != 1.0) {
+				time = (sim_time_type)((double)time / parameters.Load_scaling_factor);
+			}
+			record.Arrival_time = time;
+			return true;
+		}
+		discard_record_count = trace_reader->Get_discard_record_count();
+		flush_record_count = trace_reader->Get_flush_record_count();
+
+		return false;
+	}
+
+	void Sampling_Trace_Reader::Rewind()
+	{
+		trace_reader->Rewind();
+		discard_record_count = 0;
+		flush_record_count = 0;
+	}
+
+	void Sampling_Trace_Reader::Close()
+	{
+		trace_reader->Close();
+	}
+
+	bool Binary_Trace_Writer::Open(const std::string& file_path)
+	{
+		trace_file.open(file_path, std::ios::binary | std::ios::trunc);
+		if (!trace_file.is_open()) {
+			return false;
+		}
+
+		record_count = 0;
+		Binary_Trace_Header header;
+		std::memset(&header, 0, sizeof(header));
+		trace_file.write((const char*)&header, sizeof(header));//The header is only valid once Close() has written it
+
+		return true;
+	}
+
+	void Binary_Trace_Writer::Write(const Trace_Record& record)
+	{
+		Binary_Trace_Record binary_record;
+		binary_record.Time = record.Arrival_time;
+		binary_record.Start_LBA = record.Start_LBA;
+		binary_record.LBA_count = record.LBA_count;
+		binary_record.Device = (uint16_t)record.Device;
+		binary_record.Type = record.Type == Host_IO_Request_Type::WRITE ? BinaryTraceWriteCode : BinaryTraceReadCode;
+		binary_record.Reserved = 0;
+		trace_file.write((const char*)&binary_record, sizeof(binary_record));
+		record_count++;
+	}
+
+	bool Binary_Trace_Writer::Close()
+	{
+		Binary_Trace_Header header;
+		header.Magic = BinaryTraceMagic;
+		header.Version = BinaryTraceVersion;
+		header.Record_size = sizeof(Binary_Trace_Record);
+		header.Record_count = record_count;
+		trace_file.seekp(0, std::ios::beg);
+		trace_file.write((const char*)&header, sizeof(header));
+		trace_file.close();
+
+		return !trace_file.fail();
+	}
+}
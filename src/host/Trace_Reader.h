@@ -0,0 +1,179 @@
+#ifndef TRACE_READER_H
+#define TRACE_READER_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../sim/Sim_Defs.h"
+#include "../ssd/SSD_Defs.h"
+#include "ASCII_Trace_Definition.h"
+#include "Binary_Trace_Definition.h"
+#include "Native_Trace_Definition.h"
+#include "Host_IO_Request.h"
+
+namespace Host_Components
+{
+	struct Trace_Record
+	{
+		sim_time_type Arrival_time;
+		unsigned int Device;
+		LHA_type Start_LBA;
+		unsigned int LBA_count;
+		Host_IO_Request_Type Type;
+	};
+
+	/*
+	* Sequential reader of the requests in a trace file. Read_next returns false at the end of the
+	* file, or at the first malformed record, which is treated as the end of the trace.
+	* The readers of the native formats skip the lines that do not describe a read or a write, since
+	* these formats interleave them with other events. Discard and flush records are counted but not
+	* returned, as the SSD model does not implement these commands.
+	*/
+	class Trace_Reader
+	{
+	public:
+		Trace_Reader() : discard_record_count(0), flush_record_count(0) {}
+		virtual ~Trace_Reader() {}
+		virtual bool Open(const std::string& file_path) = 0;
+		virtual bool Read_next(Trace_Record& record) = 0;
+		virtual void Rewind() = 0;//Restarts reading from the first record
+		virtual void Close() = 0;
+		uint64_t Get_discard_record_count() const { return discard_record_count; }
+		uint64_t Get_flush_record_count() const { return flush_record_count; }
+
+		//Creates a reader for the given format. For MQSIM, the ASCII or binary format is detected from the first bytes of the file.
+		static Trace_Reader* Create(const std::string& file_path, Trace_File_Format format = Trace_File_Format::MQSIM);
+	protected:
+		uint64_t discard_record_count;
+		uint64_t flush_record_count;
+	};
+
+	class ASCII_Trace_Reader : public Trace_Reader
+	{
+	public:
+		bool Open(const std::string& file_path);
+		bool Read_next(Trace_Record& record);
+		void Rewind();
+		void Close();
+	private:
+		std::string file_path;
+		std::ifstream trace_file;
+		std::string trace_line;
+		std::vector<std::string> line_splitted;
+	};
+
+	//Memory-maps the file and decodes the fixed-width records in place
+	class Binary_Trace_Reader : public Trace_Reader
+	{
+	public:
+		Binary_Trace_Reader();
+		~Binary_Trace_Reader();
+		bool Open(const std::string& file_path);
+		bool Read_next(Trace_Record& record);
+		void Rewind();
+		void Close();
+		uint64_t Get_record_count() const;
+	private:
+		const char* mapped_file;
+		uint64_t mapped_size;
+		const Binary_Trace_Record* records;
+		uint64_t record_count;
+		uint64_t next_record;
+#ifdef _WIN32
+		void* file_handle;
+		void* mapping_handle;
+#endif
+	};
+
+	//Common line handling of the readers of the native text formats
+	class Native_Trace_Reader : public Trace_Reader
+	{
+	public:
+		bool Open(const std::string& file_path);
+		void Rewind();
+		void Close();
+	protected:
+		std::string file_path;
+		std::ifstream trace_file;
+		std::string trace_line;
+		std::vector<std::string> line_splitted;
+		bool read_line(char delimiter);//Reads the next non-empty line into line_splitted, with empty fields dropped when delimiter is a space
+		virtual bool start() { return true; }//Called when the file is (re)opened, to parse the header and reset the time base
+	};
+
+	//Reads the default text output of blkparse, replaying the requests that are issued to the driver
+	class Blkparse_Trace_Reader : public Native_Trace_Reader
+	{
+	public:
+		bool Read_next(Trace_Record& record);
+	};
+
+	class MSR_Cambridge_Trace_Reader : public Native_Trace_Reader
+	{
+	public:
+		bool Read_next(Trace_Record& record);
+	protected:
+		bool start();
+	private:
+		bool first_record_read;
+		sim_time_type first_timestamp;
+	};
+
+	//Reads fio iolog version 2 and version 3 files
+	class Fio_Iolog_Trace_Reader : public Native_Trace_Reader
+	{
+	public:
+		bool Read_next(Trace_Record& record);
+	protected:
+		bool start();
+	private:
+		bool has_timestamps;
+		sim_time_type current_time;//The sum of the wait actions so far in a version 2 iolog
+		std::vector<std::string> file_names;//The device number of a record is the index of its file
+	};
+
+	//Selects and reshapes the part of a trace that is replayed, all times are in nanoseconds of the input trace
+	struct Trace_Sampling_Parameters
+	{
+		double Load_scaling_factor;//The arrival times are divided by this factor, i.e., 2 replays the trace at twice its intensity
+		sim_time_type Window_start;//Only the requests that arrive in [Window_start, Window_end) are replayed, with their times shifted by Window_start
+		sim_time_type Window_end;//0 means the end of the trace
+		sim_time_type Sampling_period;//If not 0, only the first Sampling_length of each Sampling_period of the window is replayed,
+		sim_time_type Sampling_length;//and the remaining intervals are cut out of the timeline
+		Trace_Sampling_Parameters() : Load_scaling_factor(1.0), Window_start(0), Window_end(0), Sampling_period(0), Sampling_length(0) {}
+		bool Is_identity() const { return Load_scaling_factor == 1.0 && Window_start == 0 && Window_end == 0 && Sampling_period == 0; }
+	};
+
+	/*
+	* Applies the time window, the periodic sampling, and the load scaling of Trace_Sampling_Parameters to the
+	* records of another reader, in this order. Since it sits below both the statistics pass and the replay,
+	* the workload statistics used for preconditioning describe exactly the requests that are replayed.
+	*/
+	class Sampling_Trace_Reader : public Trace_Reader
+	{
+	public:
+		Sampling_Trace_Reader(Trace_Reader* trace_reader, const Trace_Sampling_Parameters& parameters);
+		~Sampling_Trace_Reader();
+		bool Open(const std::string& file_path);
+		bool Read_next(Trace_Record& record);
+		void Rewind();
+		void Close();
+	private:
+		Trace_Reader* trace_reader;
+		Trace_Sampling_Parameters parameters;
+	};
+
+	class Binary_Trace_Writer
+	{
+	public:
+		bool Open(const std::string& file_path);
+		void Write(const Trace_Record& record);
+		bool Close();//Writes the final record count into the header
+	private:
+		std::ofstream trace_file;
+		uint64_t record_count;
+	};
+}
+
+#endif // !TRACE_READER_H
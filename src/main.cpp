@@ -3,6 +3,17 @@
 #include <ctime>
 #include <string>
 #include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <utility>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#endif
 #include "ssd/SSD_Defs.h"
 #include "exec/Execution_Parameter_Set.h"
 #include "exec/SSD_Device.h"
@@ -13,10 +24,10 @@
 using namespace std;
 
 
-void command_line_args(char* argv[], string& input_file_path, string& workload_file_path)
+void command_line_args(int argc, char* argv[], string& input_file_path, string& workload_file_path, unsigned int& worker_count)
 {
 
-	for (int arg_cntr = 1; arg_cntr < 5; arg_cntr++) {
+	for (int arg_cntr = 1; arg_cntr < argc - 1; arg_cntr++) {
 		string arg = argv[arg_cntr];
 
 		char file_path_switch[] = "-i";
@@ -32,7 +43,40 @@ void command_line_args(char* argv[], string& input_file_path, string& workload_f
 			//cout << workload_file_path << endl;
 			continue;
 		}
+
+		char worker_count_switch[] = "-j";
+		if (arg.compare(0, strlen(worker_count_switch), worker_count_switch) == 0) {
+			int count = atoi(argv[++arg_cntr]);
+			worker_count = count > 0 ? (unsigned int)count : 1;
+			continue;
+		}
+	}
+}
+
+//A runtime variant re-runs an IO scenario with a few changed parameters on the same preconditioned device
+struct Runtime_Variant
+{
+	std::string Name;
+	std::vector<std::pair<std::string, std::string>> Parameters;
+};
+
+//Parameters that do not affect the preconditioned device state and hence may differ among the variants of a scenario.
+//The names are spelled as Device_Parameter_Set::XML_deserialize expects them.
+const char* device_level_runtime_parameters[] = { "IO_Queue_Depth", "Queue_Fetch_Size", "Caching_Mechanism", "Data_Cache_Sharing_Mode", "Data_Cache_Capacity",
+	"Data_Cache_DRAM_Row_Size", "Data_Cache_DRAM_Data_Rate", "Data_Cache_DRAM_Data_Busrt_Size", "Data_Cache_DRAM_tRCD", "Data_Cache_DRAM_tCL", "Data_Cache_DRAM_tRP",
+	"Transaction_Scheduling_Policy", "GC_Block_Selection_Policy", "Use_Copyback_for_GC", "Preemptible_GC_Enabled",
+	"Prefered_suspend_erase_time_for_read", "Preferred_suspend_erase_time_for_write", "Preferred_suspend_write_time_for_read" };
+const char* flow_level_runtime_parameters[] = { "Device_Level_Data_Caching_Mode" };
+
+bool is_runtime_parameter(const std::string& name, const char* parameters[], size_t parameter_count)
+{
+	for (size_t i = 0; i < parameter_count; i++) {
+		if (name == parameters[i]) {
+			return true;
+		}
 	}
+
+	return false;
 }
 
 void read_configuration_parameters(const string ssd_config_file_path, Execution_Parameter_Set* exec_params)
@@ -85,7 +129,7 @@ void read_configuration_parameters(const string ssd_config_file_path, Execution_
 	ssd_config_file.close();
 }
 
-std::vector<std::vector<IO_Flow_Parameter_Set*>*>* read_workload_definitions(const string workload_defs_file_path)
+std::vector<std::vector<IO_Flow_Parameter_Set*>*>* read_workload_definitions(const string workload_defs_file_path, std::vector<std::vector<Runtime_Variant>>& runtime_variants)
 {
 	std::vector<std::vector<IO_Flow_Parameter_Set*>*>* io_scenarios = new std::vector<std::vector<IO_Flow_Parameter_Set*>*>;
 
@@ -109,18 +153,36 @@ std::vector<std::vector<IO_Flow_Parameter_Set*>*>* read_workload_definitions(con
 			if (mqsim_io_scenarios != NULL) {
 				for (auto xml_io_scenario = mqsim_io_scenarios->first_node("IO_Scenario"); xml_io_scenario; xml_io_scenario = xml_io_scenario->next_sibling("IO_Scenario")) {
 					std::vector<IO_Flow_Parameter_Set*>* scenario_definition = new std::vector<IO_Flow_Parameter_Set*>;
+					std::vector<Runtime_Variant> scenario_variants;
 					for (auto flow_def = xml_io_scenario->first_node(); flow_def; flow_def = flow_def->next_sibling()) {
-						IO_Flow_Parameter_Set* flow;
+						IO_Flow_Parameter_Set* flow = NULL;
 						if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_Synthetic") == 0) {
 							flow = new IO_Flow_Parameter_Set_Synthetic;
 							((IO_Flow_Parameter_Set_Synthetic*)flow)->XML_deserialize(flow_def);
 						} else if (strcmp(flow_def->name(), "IO_Flow_Parameter_Set_Trace_Based") == 0) {
 							flow = new IO_Flow_Parameter_Set_Trace_Based;
 							((IO_Flow_Parameter_Set_Trace_Based*)flow)->XML_deserialize(flow_def);
+						} else if (strcmp(flow_def->name(), "Runtime_Variant") == 0) {
+							Runtime_Variant variant;
+							variant.Name = "variant_" + std::to_string(scenario_variants.size() + 1);
+							for (auto param = flow_def->first_node(); param; param = param->next_sibling()) {
+								if (strcmp(param->name(), "Name") == 0) {
+									variant.Name = param->value();
+								} else if (is_runtime_parameter(param->name(), device_level_runtime_parameters, sizeof(device_level_runtime_parameters) / sizeof(char*))
+									|| is_runtime_parameter(param->name(), flow_level_runtime_parameters, sizeof(flow_level_runtime_parameters) / sizeof(char*))) {
+									variant.Parameters.push_back(std::make_pair(std::string(param->name()), std::string(param->value())));
+								} else {
+									PRINT_ERROR("Parameter " << param->name() << " affects the preconditioned device state and cannot be changed in a runtime variant")
+								}
+							}
+							scenario_variants.push_back(variant);
+						}
+						if (flow != NULL) {
+							scenario_definition->push_back(flow);
 						}
-						scenario_definition->push_back(flow);
 					}
 					io_scenarios->push_back(scenario_definition);
+					runtime_variants.push_back(scenario_variants);
 					use_default_workloads = false;
 				}
 			} else {
@@ -205,6 +267,7 @@ std::vector<std::vector<IO_Flow_Parameter_Set*>*>* read_workload_definitions(con
 		scenario_definition->push_back(io_flow_2);
 
 		io_scenarios->push_back(scenario_definition);
+		runtime_variants.push_back(std::vector<Runtime_Variant>());
 
 		PRINT_MESSAGE("Writing default workload parameters to the expected input file.")
 
@@ -238,6 +301,9 @@ void collect_results(SSD_Device& ssd, Host_System& host, const char* output_file
 	
 	host.Report_results_in_XML("", xmlwriter);
 	ssd.Report_results_in_XML("", xmlwriter);
+	if (Simulator->Is_profiling_enabled()) {
+		Simulator->Get_event_profiler().Report_results_in_XML("Engine", xmlwriter);
+	}
 
 	xmlwriter.Write_close_tag();
 
@@ -248,66 +314,275 @@ void collect_results(SSD_Device& ssd, Host_System& host, const char* output_file
 		cout << "                   - device response time: " << IO_flows[stream_id]->Get_device_response_time() << " (us)"
 			<< " end-to-end request delay:" << IO_flows[stream_id]->Get_end_to_end_request_delay() << " (us)" << endl;
 	}
+	cout << "Simulation engine - events executed: " << Simulator->Get_executed_event_count() << " events cancelled: " << Simulator->Get_cancelled_event_count() << endl;
+	cout << "                  - heap allocations saved by event pooling: " << Simulator->Get_saved_heap_allocations() << endl;
+	double wall_clock_time = Simulator->Get_wall_clock_time();
+	cout << "                  - wall-clock time: " << wall_clock_time << " (s) events/s: " << (unsigned long long)(Simulator->Get_executed_event_count() / wall_clock_time)
+		<< " simulated ns per wall second: " << (unsigned long long)(Simulator->Time() / wall_clock_time) << endl;
+	if (Simulator->Is_budget_exhausted()) {
+		cout << "                  - the simulation was stopped early because its budget was exhausted" << endl;
+	}
+	if (Simulator->Is_profiling_enabled()) {
+		Simulator->Get_event_profiler().Print_summary(cout);
+	}
+}
+
+void reset_simulator(Execution_Parameter_Set* exec_params)
+{
+	//The simulator should always be reset, before starting the actual simulation
+	Simulator->Reset();
+	Simulator->Set_event_queue_type(exec_params->Engine_Configuration.Event_Queue);
+	Simulator->Set_profiling(exec_params->Engine_Configuration.Enable_Event_Profiling);
+	Simulator->Set_speed_report_period(exec_params->Engine_Configuration.Speed_Report_Period);
+	Simulator->Set_budget(exec_params->Engine_Configuration.Wall_Clock_Budget, exec_params->Engine_Configuration.Event_Budget);
+}
+
+void run_scenario(Execution_Parameter_Set* exec_params, const string& workload_defs_file_path, const string& output_file_path, const std::string* preconditioned_state)
+{
+	reset_simulator(exec_params);
+
+	SSD_Device ssd(&exec_params->SSD_Device_Configuration, &exec_params->Host_Configuration.IO_Flow_Definitions);//Create SSD_Device based on the specified parameters
+	ssd.Set_preconditioning_checkpoint_directory(exec_params->Engine_Configuration.Checkpoint_Directory);
+	ssd.Set_preconditioned_state(preconditioned_state);
+	exec_params->Host_Configuration.Input_file_path = workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of("."));//Create Host_System based on the specified parameters
+	Host_System host(&exec_params->Host_Configuration, exec_params->SSD_Device_Configuration.Enabled_Preconditioning, ssd.Host_interface);
+	host.Attach_ssd_device(&ssd);
+
+	Simulator->Start_simulation();
+
+	//time_t end_time = time(0);
+	//dt = ctime(&end_time);
+	PRINT_MESSAGE("MQSim finished at " << dt)
+	//uint64_t duration = (uint64_t)difftime(end_time, start_time);
+	PRINT_MESSAGE("Total simulation time: " << duration / 3600 << ":" << (duration % 3600) / 60 << ":" << ((duration % 3600) % 60))
+	PRINT_MESSAGE("");
+
+	PRINT_MESSAGE("Writing results to output file .......");
+	collect_results(ssd, host, output_file_path.c_str());
+}
+
+void apply_runtime_variant(const Runtime_Variant& variant, Execution_Parameter_Set* exec_params)
+{
+	rapidxml::xml_document<> doc;
+	rapidxml::xml_node<>* device_parameters = doc.allocate_node(rapidxml::node_element, "Device_Parameter_Set");
+	rapidxml::xml_node<>* flow_parameters = doc.allocate_node(rapidxml::node_element, "IO_Flow_Parameter_Set");
+	for (auto &param : variant.Parameters) {
+		rapidxml::xml_node<>* node = doc.allocate_node(rapidxml::node_element, param.first.c_str(), param.second.c_str());
+		if (is_runtime_parameter(param.first, flow_level_runtime_parameters, sizeof(flow_level_runtime_parameters) / sizeof(char*))) {
+			flow_parameters->append_node(node);
+		} else {
+			device_parameters->append_node(node);
+		}
+	}
+
+	exec_params->SSD_Device_Configuration.XML_deserialize(device_parameters);
+	for (auto &flow : exec_params->Host_Configuration.IO_Flow_Definitions) {
+		flow->IO_Flow_Parameter_Set::XML_deserialize(flow_parameters);
+	}
+}
+
+//Preconditions the device once and then runs each variant of the scenario in a forked process. The children restore the
+//preconditioned state from the copy-on-write memory of the parent, so N variants cost roughly one preconditioning pass.
+void run_scenario_variants(Execution_Parameter_Set* exec_params, const std::vector<Runtime_Variant>& variants, const string& workload_defs_file_path, const string& output_file_prefix)
+{
+#ifdef _WIN32
+	PRINT_ERROR("Runtime variants require fork() and are not supported on Windows")
+#else
+	std::string preconditioned_state;
+	{
+		reset_simulator(exec_params);
+		SSD_Device ssd(&exec_params->SSD_Device_Configuration, &exec_params->Host_Configuration.IO_Flow_Definitions);
+		ssd.Set_preconditioning_checkpoint_directory(exec_params->Engine_Configuration.Checkpoint_Directory);
+		exec_params->Host_Configuration.Input_file_path = workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of("."));
+		Host_System host(&exec_params->Host_Configuration, exec_params->SSD_Device_Configuration.Enabled_Preconditioning, ssd.Host_interface);
+		host.Attach_ssd_device(&ssd);
+		host.Precondition_ssd_device();
+		ssd.Save_preconditioned_state(preconditioned_state);
+	}
+
+	cout.flush();
+	std::vector<pid_t> children;
+	for (auto &variant : variants) {
+		pid_t pid = fork();
+		if (pid < 0) {
+			PRINT_ERROR("Unable to fork a process for variant " << variant.Name)
+		}
+		if (pid == 0) {
+			apply_runtime_variant(variant, exec_params);
+			run_scenario(exec_params, workload_defs_file_path, output_file_prefix + "_variant_" + variant.Name + ".xml", &preconditioned_state);
+			cout.flush();
+			_exit(0);
+		}
+		children.push_back(pid);
+	}
+
+	for (unsigned int i = 0; i < children.size(); i++) {
+		int status;
+		if (waitpid(children[i], &status, 0) < 0 || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+			cerr << "Variant " << variants[i].Name << " did not finish successfully" << endl;
+		}
+	}
+#endif
+}
+
+void run_io_scenario(Execution_Parameter_Set* exec_params, std::vector<IO_Flow_Parameter_Set*>* io_scenario, const std::vector<Runtime_Variant>& variants,
+	const string& workload_defs_file_path, int scenario_id)
+{
+	exec_params->Host_Configuration.IO_Flow_Definitions.clear();
+	for (auto io_flow_def = io_scenario->begin(); io_flow_def != io_scenario->end(); io_flow_def++) {
+		exec_params->Host_Configuration.IO_Flow_Definitions.push_back(*io_flow_def);
+	}
+
+	string output_file_prefix = workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of(".")) + "_scenario_" + std::to_string(scenario_id);
+	if (variants.size() > 0) {
+		run_scenario_variants(exec_params, variants, workload_defs_file_path, output_file_prefix);
+	} else {
+		run_scenario(exec_params, workload_defs_file_path, output_file_prefix + ".xml", NULL);
+	}
+}
+
+//Runs the scenarios in up to worker_count forked processes. The console output of each worker is redirected to a log file,
+//which is printed as part of the combined summary once all scenarios are finished.
+void run_io_scenarios_in_parallel(Execution_Parameter_Set* exec_params, std::vector<std::vector<IO_Flow_Parameter_Set*>*>* io_scenarios,
+	const std::vector<std::vector<Runtime_Variant>>& runtime_variants, const string& workload_defs_file_path, unsigned int worker_count)
+{
+#ifdef _WIN32
+	PRINT_ERROR("Parallel execution of the IO scenarios requires fork() and is not supported on Windows")
+#else
+	struct Scenario_Worker
+	{
+		pid_t PID = -1;
+		bool Succeeded = false;
+		std::chrono::steady_clock::time_point Start_time;
+		double Wall_clock_time = 0;
+		std::string Log_file_path;
+	};
+	std::vector<Scenario_Worker> workers(io_scenarios->size());
+	std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+	string output_file_prefix = workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of("."));
+	unsigned int next_scenario = 0, running_workers = 0;
+
+	cout << "Executing " << io_scenarios->size() << " scenarios in " << worker_count << " worker processes ......." << endl;
+	cout.flush();
+	while (next_scenario < io_scenarios->size() || running_workers > 0) {
+		if (next_scenario < io_scenarios->size() && running_workers < worker_count) {
+			Scenario_Worker& worker = workers[next_scenario];
+			worker.Log_file_path = output_file_prefix + "_scenario_" + std::to_string(next_scenario + 1) + ".log";
+			worker.Start_time = std::chrono::steady_clock::now();
+			worker.PID = fork();
+			if (worker.PID < 0) {
+				PRINT_ERROR("Unable to fork a worker process for scenario " << next_scenario + 1)
+			}
+			if (worker.PID == 0) {
+				//PRINT_ERROR waits for a key press, which must not block a failed worker on the shared terminal
+				int null_input = open("/dev/null", O_RDONLY);
+				if (null_input >= 0) {
+					dup2(null_input, STDIN_FILENO);
+					close(null_input);
+				}
+				int log_file = open(worker.Log_file_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+				if (log_file >= 0) {
+					dup2(log_file, STDOUT_FILENO);
+					dup2(log_file, STDERR_FILENO);
+					close(log_file);
+				}
+				run_io_scenario(exec_params, (*io_scenarios)[next_scenario], runtime_variants[next_scenario], workload_defs_file_path, next_scenario + 1);
+				cout.flush();
+				_exit(0);
+			}
+			next_scenario++;
+			running_workers++;
+			continue;
+		}
+
+		int status;
+		pid_t pid = waitpid(-1, &status, 0);
+		if (pid < 0) {
+			break;
+		}
+		for (auto &worker : workers) {
+			if (worker.PID == pid) {
+				worker.Succeeded = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+				worker.Wall_clock_time = std::chrono::duration<double>(std::chrono::steady_clock::now() - worker.Start_time).count();
+				cout << "Scenario " << (&worker - &workers[0]) + 1 << " " << (worker.Succeeded ? "finished" : "failed") << endl;
+				running_workers--;
+				break;
+			}
+		}
+	}
+
+	cout << endl << "******************************" << endl;
+	cout << "Summary of " << io_scenarios->size() << " scenarios" << endl;
+	unsigned int failed_scenarios = 0;
+	for (unsigned int i = 0; i < workers.size(); i++) {
+		cout << "Scenario " << i + 1 << " - " << (workers[i].Succeeded ? "finished" : "FAILED") << " in " << workers[i].Wall_clock_time << " (s)" << endl;
+		ifstream log_file(workers[i].Log_file_path.c_str());
+		string line;
+		while (std::getline(log_file, line)) {
+			cout << "    " << line << endl;
+		}
+		log_file.close();
+		std::remove(workers[i].Log_file_path.c_str());
+		if (!workers[i].Succeeded) {
+			failed_scenarios++;
+		}
+	}
+	cout << "Total wall-clock time: " << std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count() << " (s), "
+		<< failed_scenarios << " failed scenarios" << endl;
+#endif
 }
 
 void print_help()
 {
 	cout << "MQSim - SSD simulator with both NVMe and SATA host interface behavior, see ReadMe.md for details" << endl <<
 		"Standalone Usage:" << endl <<
-		"./MQSim [-i path/to/config/file] [-w path/to/workload/file]" << endl;
+		"./MQSim [-i path/to/config/file] [-w path/to/workload/file] [-j number/of/worker/processes]" << endl;
 }
 
 int main(int argc, char* argv[])
 {
 	string ssd_config_file_path, workload_defs_file_path;
-	if (argc != 5) {
+	unsigned int worker_count = 1;
+	if (argc != 5 && argc != 7) {
 		// MQSim expects 2 arguments: 1) the path to the SSD configuration definition file, and 2) the path to the workload definition file
+		// Optionally, the number of worker processes that execute the IO scenarios in parallel could be specified
 		print_help();
 		return 1;
 	}
 
-	command_line_args(argv, ssd_config_file_path, workload_defs_file_path);
+	command_line_args(argc, argv, ssd_config_file_path, workload_defs_file_path, worker_count);
 
 	Execution_Parameter_Set* exec_params = new Execution_Parameter_Set;
 	read_configuration_parameters(ssd_config_file_path, exec_params);
-	std::vector<std::vector<IO_Flow_Parameter_Set*>*>* io_scenarios = read_workload_definitions(workload_defs_file_path);
-
-	int cntr = 1;
-	for (auto io_scen = io_scenarios->begin(); io_scen != io_scenarios->end(); io_scen++, cntr++) {
-		//time_t start_time = time(0);
-		//char* dt = ctime(&start_time);
-		PRINT_MESSAGE("MQSim started at " << dt)
-		PRINT_MESSAGE("******************************")
-		PRINT_MESSAGE("Executing scenario " << cntr << " out of " << io_scenarios->size() << " .......")
-
-		//The simulator should always be reset, before starting the actual simulation
-		Simulator->Reset();
-
-		exec_params->Host_Configuration.IO_Flow_Definitions.clear();
-		for (auto io_flow_def = (*io_scen)->begin(); io_flow_def != (*io_scen)->end(); io_flow_def++) {
-			exec_params->Host_Configuration.IO_Flow_Definitions.push_back(*io_flow_def);
-		}
+	std::vector<std::vector<Runtime_Variant>> runtime_variants;
+	std::vector<std::vector<IO_Flow_Parameter_Set*>*>* io_scenarios = read_workload_definitions(workload_defs_file_path, runtime_variants);
 
-		SSD_Device ssd(&exec_params->SSD_Device_Configuration, &exec_params->Host_Configuration.IO_Flow_Definitions);//Create SSD_Device based on the specified parameters
-		exec_params->Host_Configuration.Input_file_path = workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of("."));//Create Host_System based on the specified parameters
-		Host_System host(&exec_params->Host_Configuration, exec_params->SSD_Device_Configuration.Enabled_Preconditioning, ssd.Host_interface);
-		host.Attach_ssd_device(&ssd);
-
-		Simulator->Start_simulation();
-
-		//time_t end_time = time(0);
-		//dt = ctime(&end_time);
-		PRINT_MESSAGE("MQSim finished at " << dt)
-		//uint64_t duration = (uint64_t)difftime(end_time, start_time);
-		PRINT_MESSAGE("Total simulation time: " << duration / 3600 << ":" << (duration % 3600) / 60 << ":" << ((duration % 3600) % 60))
-		PRINT_MESSAGE("");
-
-		PRINT_MESSAGE("Writing results to output file .......");
-		collect_results(ssd, host, (workload_defs_file_path.substr(0, workload_defs_file_path.find_last_of(".")) + "_scenario_" + std::to_string(cntr) + ".xml").c_str());
+	if (worker_count > 1 && io_scenarios->size() > 1) {
+		run_io_scenarios_in_parallel(exec_params, io_scenarios, runtime_variants, workload_defs_file_path, worker_count);
+	} else {
+		int cntr = 1;
+		for (auto io_scen = io_scenarios->begin(); io_scen != io_scenarios->end(); io_scen++, cntr++) {
+			//time_t start_time = time(0);
+			//char* dt = ctime(&start_time);
+			PRINT_MESSAGE("MQSim started at " << dt)
+			PRINT_MESSAGE("******************************")
+			PRINT_MESSAGE("Executing scenario " << cntr << " out of " << io_scenarios->size() << " .......")
+
+			run_io_scenario(exec_params, *io_scen, runtime_variants[cntr - 1], workload_defs_file_path, cntr);
+		}
+	}
+	//Batch runs, i.e., runs with -j or without a terminal on stdin, do not wait for a key press
+#ifdef _WIN32
+	bool interactive = _isatty(_fileno(stdin)) != 0;
+#else
+	bool interactive = isatty(STDIN_FILENO) != 0;
+#endif
+	if (argc == 5 && interactive) {
+		cout << "Simulation complete; Press any key to exit." << endl;
+		cin.get();
+	} else {
+		cout << "Simulation complete." << endl;
 	}
-    cout << "Simulation complete; Press any key to exit." << endl;
-
-	cin.get(); // Disable if you prefer batch runs
 
 	return 0;
 }
\ No newline at end of file
@@ -76,6 +76,34 @@ namespace NVM
 			Dies[flash_address->DieID]->Planes[flash_address->PlaneID]->Blocks[flash_address->BlockID]->Pages[flash_address->PageID].Metadata.LPA = *(LPA_type*)status_info;
 		}
 		
+		void Flash_Chip::Save_checkpoint(Utils::Checkpoint_Writer& writer)
+		{
+			for (unsigned int die_id = 0; die_id < die_no; die_id++) {
+				for (unsigned int plane_id = 0; plane_id < plane_no_in_die; plane_id++) {
+					for (unsigned int block_id = 0; block_id < block_no_in_plane; block_id++) {
+						Block* block = Dies[die_id]->Planes[plane_id]->Blocks[block_id];
+						for (unsigned int page_id = 0; page_id < page_no_per_block; page_id++) {
+							writer.Write(block->Pages[page_id].Metadata.LPA);
+						}
+					}
+				}
+			}
+		}
+
+		void Flash_Chip::Load_checkpoint(Utils::Checkpoint_Reader& reader)
+		{
+			for (unsigned int die_id = 0; die_id < die_no; die_id++) {
+				for (unsigned int plane_id = 0; plane_id < plane_no_in_die; plane_id++) {
+					for (unsigned int block_id = 0; block_id < block_no_in_plane; block_id++) {
+						Block* block = Dies[die_id]->Planes[plane_id]->Blocks[block_id];
+						for (unsigned int page_id = 0; page_id < page_no_per_block; page_id++) {
+							reader.Read(block->Pages[page_id].Metadata.LPA);
+						}
+					}
+				}
+			}
+		}
+		
 		void Flash_Chip::Setup_triggers()
 		{
 			MQSimEngine::Sim_Object::Setup_triggers();
@@ -213,7 +241,7 @@ namespace NVM
 			throw "Suspend is not supported for read operations!";*/
 
 			targetDie->RemainingSuspendedExecTime = targetDie->Expected_finish_time - Simulator->Time();
-			Simulator->Ignore_sim_event(targetDie->CommandFinishEvent);//The simulator engine should not execute the finish event for the suspended command
+			Simulator->Cancel_sim_event(targetDie->CommandFinishEvent);//The simulator engine should not execute the finish event for the suspended command
 			targetDie->CommandFinishEvent = NULL;
 
 			targetDie->SuspendedCMD = targetDie->CurrentCMD;
@@ -9,6 +9,7 @@
 #include "FlashTypes.h"
 #include "Die.h"
 #include "Flash_Command.h"
+#include "../../utils/Checkpoint.h"
 #include <vector>
 #include <stdexcept>
 
@@ -75,6 +76,8 @@ namespace NVM
 				this->lastTransferStart = INVALID_TIME;
 			}
 			void Change_memory_status_preconditioning(const NVM_Memory_Address* address, const void* status_info);
+			void Save_checkpoint(Utils::Checkpoint_Writer& writer);//Stores the page metadata that is set during preconditioning
+			void Load_checkpoint(Utils::Checkpoint_Reader& reader);
 			void Start_simulation();
 			void Validate_simulation_config();
 			void Setup_triggers();
@@ -1,10 +1,12 @@
+#include <algorithm>
 #include <stdexcept>
 #include "Engine.h"
+#include "EventCalendar.h"
 #include "../utils/Logical_Address_Partitioning_Unit.h"
 
 namespace MQSimEngine
 {
-	Engine* Engine::_instance = NULL;
+	thread_local Engine* Engine::_instance = NULL;
 
 	Engine* Engine::Instance() {
 		if (_instance == 0) {
@@ -13,13 +15,41 @@ namespace MQSimEngine
 		return _instance;
 	}
 
+	//Selects the data structure that holds the pending events. It can only be changed when no event is pending.
+	void Engine::Set_event_queue_type(Event_Queue_Type type)
+	{
+		if (_EventList->Count > 0) {
+			throw std::logic_error("The event queue type cannot be changed while there are pending events.");
+		}
+
+		delete _EventList;
+		switch (type) {
+			case Event_Queue_Type::CALENDAR_QUEUE:
+				_EventList = new EventCalendar(node_pool);
+				break;
+			case Event_Queue_Type::RED_BLACK_TREE:
+			default:
+				_EventList = new EventTree(node_pool);
+				break;
+		}
+	}
+
 	void Engine::Reset()
 	{
 		_EventList->Clear();
+		event_pool.Reset();
+		node_pool.Reset();
 		_ObjectList.clear();
 		_sim_time = 0;
+		executing_node = NULL;
+		executed_events = 0;
+		cancelled_events = 0;
+		event_profiler.Clear();
+		end_of_timestep_objects.clear();
+		budget_exhausted = false;
 		stop = false;
 		started = false;
+		start_progress_tracking();
 		Utils::Logical_Address_Partitioning_Unit::Reset();
 	}
 
@@ -77,26 +107,121 @@ namespace MQSimEngine
 			obj->second->Start_simulation();
 		}
 		
-		Sim_Event* ev = NULL;
+		start_progress_tracking();
 		while (true) {
 			if (_EventList->Count == 0 || stop) {
 				break;
 			}
 
 			EventTreeNode* minNode = _EventList->Get_min_node();
-			ev = minNode->FirstSimEvent;
+			_sim_time = minNode->Key;
+			execute_node(minNode);
+			if (executed_events >= next_progress_check) {
+				check_progress();
+			}
+		}
+	}
 
-			_sim_time = ev->Fire_time;
+	void Engine::start_progress_tracking()
+	{
+		start_wall_time = std::chrono::steady_clock::now();
+		last_report_wall_time = start_wall_time;
+		last_report_sim_time = _sim_time;
+		last_report_executed_events = executed_events;
+		next_progress_check = executed_events + ENGINE_PROGRESS_CHECK_INTERVAL;
+		if (event_budget > 0 && event_budget < next_progress_check) {
+			next_progress_check = event_budget;
+		}
+	}
+
+	//Reports the simulation speed and stops the simulation if the wall-clock or event budget is exhausted
+	void Engine::check_progress()
+	{
+		next_progress_check = executed_events + ENGINE_PROGRESS_CHECK_INTERVAL;
+		if (event_budget > 0) {
+			if (executed_events >= event_budget) {
+				std::cout << "Simulation stopped: the budget of " << event_budget << " events is exhausted at " << _sim_time << " ns" << std::endl;
+				budget_exhausted = true;
+				Stop_simulation();
+				return;
+			}
+			if (event_budget < next_progress_check) {
+				next_progress_check = event_budget;
+			}
+		}
+
+		if (speed_report_period == 0 && wall_clock_budget == 0) {
+			return;
+		}
+
+		auto now = std::chrono::steady_clock::now();
+		if (speed_report_period > 0) {
+			double elapsed = std::chrono::duration<double>(now - last_report_wall_time).count();
+			if (elapsed >= speed_report_period) {
+				std::cout << "Simulation speed - events/s: " << (unsigned long long)((executed_events - last_report_executed_events) / elapsed)
+					<< " simulated ns per wall second: " << (unsigned long long)((_sim_time - last_report_sim_time) / elapsed)
+					<< " simulated time: " << _sim_time << " ns" << std::endl;
+				last_report_wall_time = now;
+				last_report_sim_time = _sim_time;
+				last_report_executed_events = executed_events;
+			}
+		}
+		if (wall_clock_budget > 0 && std::chrono::duration<double>(now - start_wall_time).count() >= wall_clock_budget) {
+			std::cout << "Simulation stopped: the wall-clock budget of " << wall_clock_budget << " seconds is exhausted at " << _sim_time << " ns" << std::endl;
+			budget_exhausted = true;
+			Stop_simulation();
+		}
+	}
 
-			while (ev != NULL) {
-				if(!ev->Ignore) {
+	//Executes all the events of a node (i.e., the events that fire at the current time) and removes the node from the event queue.
+	//Events that are registered for the current time while the node is executing are appended to the same node.
+	//The end-of-timestep callbacks are executed when the last event of the node is reached, they may append new events to the node.
+	void Engine::execute_node(EventTreeNode* node)
+	{
+		executing_node = node;
+		Sim_Event* ev = node->FirstSimEvent;
+		while (ev != NULL) {
+			if (!ev->Ignore) {
+				if (profiling_enabled) {
+					auto start = std::chrono::steady_clock::now();
+					ev->Target_sim_object->Execute_simulator_event(ev);
+					event_profiler.Record(ev->Target_sim_object, ev->Type, std::chrono::steady_clock::now() - start);
+				} else {
 					ev->Target_sim_object->Execute_simulator_event(ev);
 				}
-				Sim_Event* consumed_event = ev;
-				ev = ev->Next_event;
-				delete consumed_event;
+				executed_events++;
+			}
+			while (ev->Next_event == NULL && !end_of_timestep_objects.empty()) {
+				execute_end_of_timestep_callbacks();
 			}
-			_EventList->Remove(minNode);
+			Sim_Event* consumed_event = ev;
+			ev = ev->Next_event;
+			event_pool.Release(consumed_event);
+		}
+		executing_node = NULL;
+		_EventList->Remove(node);
+	}
+
+	void Engine::execute_end_of_timestep_callbacks()
+	{
+		//The callbacks may register new callbacks, they are executed in the next round
+		executing_end_of_timestep_objects.swap(end_of_timestep_objects);
+		for (auto obj : executing_end_of_timestep_objects) {
+			obj->Execute_end_of_timestep_callback();
+		}
+		executing_end_of_timestep_objects.clear();
+	}
+
+	void Engine::Register_end_of_timestep_callback(Sim_Object* obj)
+	{
+		if (executing_node == NULL) {
+			//Not called from an event handler (e.g., during preconditioning or by a co-simulation host), so there is nothing to wait for
+			obj->Execute_end_of_timestep_callback();
+			return;
+		}
+
+		if (std::find(end_of_timestep_objects.begin(), end_of_timestep_objects.end(), obj) == end_of_timestep_objects.end()) {
+			end_of_timestep_objects.push_back(obj);
 		}
 	}
 
@@ -117,7 +242,7 @@ namespace MQSimEngine
 
 	Sim_Event* Engine::Register_sim_event(sim_time_type fireTime, Sim_Object* targetObject, void* parameters, int type)
 	{
-		Sim_Event* ev = new Sim_Event(fireTime, targetObject, parameters, type);
+		Sim_Event* ev = event_pool.Allocate(fireTime, targetObject, parameters, type);
 		DEBUG("RegisterEvent " << fireTime << " " << targetObject)
 		_EventList->Insert_sim_event(ev);
 		return ev;
@@ -128,11 +253,98 @@ namespace MQSimEngine
 		ev->Ignore = true;
 	}
 
+	void Engine::Cancel_sim_event(Sim_Event* ev)
+	{
+		EventTreeNode* node = _EventList->Find_node(ev->Fire_time);
+		if (node == NULL) {
+			PRINT_ERROR("Cancelling an event that is not pending in the event queue.")
+		}
+		if (node == executing_node) {
+			//The engine is iterating over the events of this node, so the event is just skipped
+			ev->Ignore = true;
+			cancelled_events++;
+			return;
+		}
+
+		Sim_Event* prev = NULL;
+		for (Sim_Event* it = node->FirstSimEvent; it != ev; it = it->Next_event) {
+			if (it == NULL) {
+				PRINT_ERROR("Cancelling an event that is not pending in the event queue.")
+			}
+			prev = it;
+		}
+		if (prev == NULL) {
+			node->FirstSimEvent = ev->Next_event;
+		} else {
+			prev->Next_event = ev->Next_event;
+		}
+		if (node->LastSimEvent == ev) {
+			node->LastSimEvent = prev;
+		}
+		event_pool.Release(ev);
+		cancelled_events++;
+
+		if (node->FirstSimEvent == NULL) {
+			_EventList->Remove(node);
+		}
+	}
+
 	bool Engine::Is_integrated_execution_mode() const
 	{
 		return false;
 	}
 
+	unsigned long long Engine::Get_saved_heap_allocations() const
+	{
+		return event_pool.Get_saved_heap_allocations() + node_pool.Get_saved_heap_allocations();
+	}
+
+	unsigned long long Engine::Get_executed_event_count() const
+	{
+		return executed_events;
+	}
+
+	unsigned long long Engine::Get_cancelled_event_count() const
+	{
+		return cancelled_events;
+	}
+
+	void Engine::Set_profiling(bool enabled)
+	{
+		profiling_enabled = enabled;
+	}
+
+	bool Engine::Is_profiling_enabled() const
+	{
+		return profiling_enabled;
+	}
+
+	Event_Profiler& Engine::Get_event_profiler()
+	{
+		return event_profiler;
+	}
+
+	void Engine::Set_speed_report_period(double seconds)
+	{
+		speed_report_period = seconds;
+	}
+
+	void Engine::Set_budget(double wall_clock_seconds, unsigned long long events)
+	{
+		wall_clock_budget = wall_clock_seconds;
+		event_budget = events;
+	}
+
+	bool Engine::Is_budget_exhausted() const
+	{
+		return budget_exhausted;
+	}
+
+	double Engine::Get_wall_clock_time() const
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_wall_time).count();
+	}
+
 	// 2021.4.9
 	void Engine::get_ready() {
 		started = true;
@@ -150,6 +362,7 @@ namespace MQSimEngine
 			++obj) {
 			obj->second->Start_simulation();
 		}
+		start_progress_tracking();
 	}
 
 	bool Engine::is_event_tree_empty() const {
@@ -165,26 +378,45 @@ namespace MQSimEngine
 		++_sim_time;
 		if (_EventList->Count > 0 && !stop) {
 			auto minNode = _EventList->Get_min_node();
-			auto ev = minNode->FirstSimEvent;
-			if(_sim_time == ev->Fire_time) {
-				while (ev != nullptr) {
-					if(!ev->Ignore) {
-						ev->Target_sim_object->Execute_simulator_event(ev);
-					}
-					auto consumed_event = ev;
-					ev = ev->Next_event;
-					delete consumed_event;
-				}
-				_EventList->Remove(minNode);
+			if(_sim_time == minNode->Key) {
+				execute_node(minNode);
 			}
 		}
 	}
 
+	//Executes all the events that fire at or before the given time in one call and moves the simulation time to it.
+	//Returns the fire time of the next pending event, or 0 if there is no pending event.
+	sim_time_type Engine::Advance_until(sim_time_type time) {
+		while (_EventList->Count > 0 && !stop) {
+			EventTreeNode* minNode = _EventList->Get_min_node();
+			if (minNode->Key > time) {
+				break;
+			}
+			_sim_time = minNode->Key;
+			execute_node(minNode);
+			if (executed_events >= next_progress_check) {
+				check_progress();
+			}
+		}
+		if (!stop && _sim_time < time) {
+			_sim_time = time;
+		}
+
+		return get_next_event_firetime();
+	}
+
 	void Engine::set_sim_time(sim_time_type time) {
 		_sim_time = time;
 	}
 
 	void Engine::clear_dummy_event() {
 		_EventList->Clear();
+		executed_events = 0;
+		cancelled_events = 0;
+		event_profiler.Clear();
+		end_of_timestep_objects.clear();
+		event_pool.Reset();
+		node_pool.Reset();
+		start_progress_tracking();
 	}
 }
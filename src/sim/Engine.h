@@ -1,12 +1,19 @@
 #ifndef ENGINE_H
 #define ENGINE_H
 
+#include <chrono>
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 #include "Sim_Defs.h"
+#include "EventQueue.h"
 #include "EventTree.h"
+#include "Object_Pool.h"
+#include "Event_Profiler.h"
 #include "Sim_Object.h"
 
+#define ENGINE_PROGRESS_CHECK_INTERVAL 4096 //The number of executed events between two checks of the wall-clock time
+
 namespace MQSimEngine {
 	class Engine
 	{
@@ -14,18 +21,38 @@ namespace MQSimEngine {
 	public:
 		Engine()
 		{
-			this->_EventList = new EventTree;
+			this->_EventList = new EventTree(node_pool);
 			started = false;
+			executing_node = NULL;
+			executed_events = 0;
+			cancelled_events = 0;
+			profiling_enabled = false;
+			speed_report_period = 0;
+			wall_clock_budget = 0;
+			event_budget = 0;
+			budget_exhausted = false;
 		}
 
 		~Engine() {
 			delete _EventList;
 		}
 		
+		//Each thread owns a separate engine together with all the per-simulation state of the SSD components,
+		//so independent simulations can run concurrently on different threads of the same process
 		static Engine* Instance();
+		void Set_event_queue_type(Event_Queue_Type type);
 		sim_time_type Time() const;
 		Sim_Event* Register_sim_event(sim_time_type fireTime, Sim_Object* targetObject, void* parameters = NULL, int type = 0);
+		template <typename T>
+		Sim_Event* Register_sim_event_with_payload(sim_time_type fireTime, Sim_Object* targetObject, const T& payload, int type = 0)
+		{
+			Sim_Event* ev = Register_sim_event(fireTime, targetObject, NULL, type);
+			ev->Set_payload(payload);
+			return ev;
+		}
 		void Ignore_sim_event(Sim_Event*);
+		void Cancel_sim_event(Sim_Event*);//Removes a pending event from the event queue, the event pointer must not be used afterwards
+		void Register_end_of_timestep_callback(Sim_Object* obj);//Requests a single call to obj->Execute_end_of_timestep_callback() after the events of the current time
 		void Reset();
 		void AddObject(Sim_Object* obj);
 		Sim_Object* GetObject(sim_object_id_type object_id) const;
@@ -34,21 +61,53 @@ namespace MQSimEngine {
 		void Stop_simulation();
 		bool Has_started() const;
 		bool Is_integrated_execution_mode() const;
+		unsigned long long Get_saved_heap_allocations() const;//The number of heap allocations that are avoided by the event and node pools
+		unsigned long long Get_executed_event_count() const;
+		unsigned long long Get_cancelled_event_count() const;
+		void Set_profiling(bool enabled);//Records the number of events and the wall-clock time spent in Execute_simulator_event per object and event type
+		bool Is_profiling_enabled() const;
+		Event_Profiler& Get_event_profiler();
+		void Set_speed_report_period(double seconds);//The wall-clock period of the speed reports, 0 disables them
+		void Set_budget(double wall_clock_seconds, unsigned long long events);//The simulation is stopped once either budget is exhausted, 0 means unlimited
+		bool Is_budget_exhausted() const;
+		double Get_wall_clock_time() const;//The wall-clock time in seconds since the start of the simulation
 
 		// 2021.4.9
 		void get_ready();
 		bool is_event_tree_empty() const;
 		sim_time_type get_next_event_firetime() const;
 		void tick();
+		sim_time_type Advance_until(sim_time_type time);
 		void set_sim_time(sim_time_type time);
 		void clear_dummy_event();
 	private:
 		sim_time_type _sim_time;
-		EventTree* _EventList;
+		EventQueue* _EventList;
+		Object_Pool<Sim_Event> event_pool;
+		Object_Pool<EventTreeNode> node_pool;
+		EventTreeNode* executing_node;//The node whose events are being executed, its events can only be cancelled using the Ignore flag
+		unsigned long long executed_events;
+		unsigned long long cancelled_events;
+		bool profiling_enabled;
+		Event_Profiler event_profiler;
+		std::vector<Sim_Object*> end_of_timestep_objects;//The objects whose end-of-timestep callbacks are pending for the executing node
+		std::vector<Sim_Object*> executing_end_of_timestep_objects;
+		void execute_node(EventTreeNode* node);
+		void execute_end_of_timestep_callbacks();
+		double speed_report_period;
+		double wall_clock_budget;
+		unsigned long long event_budget;
+		bool budget_exhausted;
+		std::chrono::steady_clock::time_point start_wall_time, last_report_wall_time;
+		sim_time_type last_report_sim_time;
+		unsigned long long last_report_executed_events;
+		unsigned long long next_progress_check;//The executed event count at which the speed and budgets are checked next
+		void start_progress_tracking();
+		void check_progress();
 		std::unordered_map<sim_object_id_type, Sim_Object*> _ObjectList;
 		bool stop;
 		bool started;
-		static Engine* _instance;
+		static thread_local Engine* _instance;
 	};
 }
 
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include "EventCalendar.h"
+#include "Engine.h"
+
+namespace MQSimEngine
+{
+	EventCalendar::EventCalendar(Object_Pool<EventTreeNode>& node_pool) : EventQueue(node_pool),
+		bucket_count(CALENDAR_MIN_BUCKET_COUNT), bucket_mask(CALENDAR_MIN_BUCKET_COUNT - 1),
+		bucket_width_bits(CALENDAR_INITIAL_BUCKET_WIDTH_BITS), current_day(0), min_node(NULL)
+	{
+		buckets = new EventTreeNode*[bucket_count]();
+	}
+
+	EventCalendar::~EventCalendar()
+	{
+		Clear();
+		delete[] buckets;
+	}
+
+	void EventCalendar::Insert_sim_event(Sim_Event* event)
+	{
+		if (event->Fire_time < Engine::Instance()->Time()) {
+			PRINT_ERROR("Illegal request to register a simulation event before Now!")
+		}
+
+		sim_time_type key = event->Fire_time;
+		sim_time_type day = key >> bucket_width_bits;
+		if (day < current_day) {
+			current_day = day;
+		}
+
+		//Find the node with the same key or the position of the new node in the sorted bucket
+		EventTreeNode** link = &buckets[day & bucket_mask];
+		while (*link != NULL && (*link)->Key < key) {
+			link = &(*link)->Right;
+		}
+		if (*link != NULL && (*link)->Key == key) {
+			(*link)->LastSimEvent->Next_event = event;
+			(*link)->LastSimEvent = event;
+			return;
+		}
+
+		EventTreeNode* node = node_pool.Allocate();
+		node->Key = key;
+		node->FirstSimEvent = event;
+		node->LastSimEvent = event;
+		node->Right = *link;
+		*link = node;
+		Count++;
+
+		if (min_node != NULL && key < min_node->Key) {
+			min_node = node;
+		}
+
+		if ((unsigned int)Count > 2 * bucket_count) {
+			resize(2 * bucket_count);
+		}
+	}
+
+	EventTreeNode* EventCalendar::Get_min_node()
+	{
+		if (min_node != NULL) {
+			return min_node;
+		}
+		if (Count == 0) {
+			return NULL;
+		}
+
+		//Scan one year of the calendar, starting from the current day
+		for (unsigned int i = 0; i < bucket_count; i++, current_day++) {
+			EventTreeNode* head = buckets[current_day & bucket_mask];
+			if (head != NULL && (head->Key >> bucket_width_bits) == current_day) {
+				min_node = head;
+				return min_node;
+			}
+		}
+
+		//All the pending events are more than one year ahead, search the bucket heads directly
+		for (unsigned int i = 0; i < bucket_count; i++) {
+			if (buckets[i] != NULL && (min_node == NULL || buckets[i]->Key < min_node->Key)) {
+				min_node = buckets[i];
+			}
+		}
+		current_day = min_node->Key >> bucket_width_bits;
+
+		return min_node;
+	}
+
+	EventTreeNode* EventCalendar::Find_node(sim_time_type key)
+	{
+		EventTreeNode* node = buckets[(key >> bucket_width_bits) & bucket_mask];
+		while (node != NULL && node->Key < key) {
+			node = node->Right;
+		}
+		if (node != NULL && node->Key == key) {
+			return node;
+		}
+		return NULL;
+	}
+
+	void EventCalendar::Remove(EventTreeNode* node)
+	{
+		EventTreeNode** link = &buckets[(node->Key >> bucket_width_bits) & bucket_mask];
+		while (*link != node) {
+			link = &(*link)->Right;
+		}
+		*link = node->Right;
+		if (min_node == node) {
+			min_node = NULL;
+		}
+		node_pool.Release(node);
+		Count--;
+
+		if (bucket_count > CALENDAR_MIN_BUCKET_COUNT && (unsigned int)Count < bucket_count / 2) {
+			resize(bucket_count / 2);
+		}
+	}
+
+	void EventCalendar::Clear()
+	{
+		for (unsigned int i = 0; i < bucket_count; i++) {
+			EventTreeNode* node = buckets[i];
+			while (node != NULL) {
+				EventTreeNode* next = node->Right;
+				node_pool.Release(node);
+				node = next;
+			}
+			buckets[i] = NULL;
+		}
+		Count = 0;
+		current_day = 0;
+		min_node = NULL;
+	}
+
+	void EventCalendar::insert_node(EventTreeNode* node)
+	{
+		EventTreeNode** link = &buckets[(node->Key >> bucket_width_bits) & bucket_mask];
+		while (*link != NULL && (*link)->Key < node->Key) {
+			link = &(*link)->Right;
+		}
+		node->Right = *link;
+		*link = node;
+	}
+
+	void EventCalendar::resize(unsigned int new_bucket_count)
+	{
+		resize_buffer.clear();
+		for (unsigned int i = 0; i < bucket_count; i++) {
+			for (EventTreeNode* node = buckets[i]; node != NULL; node = node->Right) {
+				resize_buffer.push_back(node);
+			}
+		}
+
+		sim_time_type current_time = current_day << bucket_width_bits;
+		bucket_width_bits = estimate_bucket_width_bits();
+		current_day = current_time >> bucket_width_bits;
+
+		delete[] buckets;
+		bucket_count = new_bucket_count;
+		bucket_mask = new_bucket_count - 1;
+		buckets = new EventTreeNode*[bucket_count]();
+		for (auto node : resize_buffer) {
+			insert_node(node);
+		}
+	}
+
+	/*
+	* Brown's heuristic: the bucket width is set to three times the average separation of the
+	* earliest pending fire times, ignoring separations that are much larger than the average.
+	* The width is rounded up to a power of two, so that the bucket of a key is found by shift and mask.
+	*/
+	unsigned int EventCalendar::estimate_bucket_width_bits()
+	{
+		size_t sample_size = std::min(resize_buffer.size(), (size_t)CALENDAR_WIDTH_SAMPLE_SIZE);
+		if (sample_size < 2) {
+			return bucket_width_bits;
+		}
+
+		std::partial_sort(resize_buffer.begin(), resize_buffer.begin() + sample_size, resize_buffer.end(),
+			[](const EventTreeNode* a, const EventTreeNode* b) { return a->Key < b->Key; });
+		double average_separation = double(resize_buffer[sample_size - 1]->Key - resize_buffer[0]->Key) / double(sample_size - 1);
+		double total_separation = 0;
+		unsigned int separation_count = 0;
+		for (size_t i = 1; i < sample_size; i++) {
+			double separation = double(resize_buffer[i]->Key - resize_buffer[i - 1]->Key);
+			if (separation <= 2 * average_separation) {
+				total_separation += separation;
+				separation_count++;
+			}
+		}
+		if (separation_count > 0) {
+			average_separation = total_separation / separation_count;
+		}
+
+		sim_time_type width = (sim_time_type)(3 * average_separation);
+		unsigned int width_bits = 0;
+		while (width_bits < 63 && (sim_time_type(1) << width_bits) < width) {
+			width_bits++;
+		}
+
+		return width_bits;
+	}
+}
@@ -0,0 +1,49 @@
+#ifndef EVENT_CALENDAR_H
+#define EVENT_CALENDAR_H
+
+#include <vector>
+#include "Sim_Defs.h"
+#include "Sim_Event.h"
+#include "EventQueue.h"
+
+#define CALENDAR_MIN_BUCKET_COUNT 16
+#define CALENDAR_INITIAL_BUCKET_WIDTH_BITS 10 //1024 ns per bucket
+#define CALENDAR_WIDTH_SAMPLE_SIZE 25 //The number of earliest nodes that are sampled to re-estimate the bucket width
+
+namespace MQSimEngine
+{
+	/*
+	* Calendar queue (R. Brown, "Calendar Queues: A Fast O(1) Priority Queue Implementation
+	* for the Simulation Event Set Problem", CACM 1988).
+	* The time axis is divided into "days" of 2^bucket_width_bits nanoseconds, and day d is
+	* stored in bucket (d mod bucket_count). Each bucket keeps its nodes sorted by key. The
+	* bucket count and width are adjusted as the number of pending fire times changes, so
+	* that each bucket holds a few nodes and insert/extract take O(1) amortized time.
+	*/
+	class EventCalendar : public EventQueue
+	{
+	public:
+		EventCalendar(Object_Pool<EventTreeNode>& node_pool);
+		~EventCalendar();
+
+		void Insert_sim_event(Sim_Event* data);
+		EventTreeNode* Get_min_node();
+		EventTreeNode* Find_node(sim_time_type key);
+		void Remove(EventTreeNode* node);
+		void Clear();
+	private:
+		EventTreeNode** buckets;
+		unsigned int bucket_count;//Always a power of two
+		unsigned int bucket_mask;
+		unsigned int bucket_width_bits;
+		sim_time_type current_day;//No node has a key which belongs to a day before current_day
+		EventTreeNode* min_node;//The cached result of Get_min_node, NULL if it should be searched again
+		std::vector<EventTreeNode*> resize_buffer;
+
+		void insert_node(EventTreeNode* node);
+		void resize(unsigned int new_bucket_count);
+		unsigned int estimate_bucket_width_bits();
+	};
+}
+
+#endif // !EVENT_CALENDAR_H
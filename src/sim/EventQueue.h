@@ -0,0 +1,64 @@
+#ifndef EVENT_QUEUE_H
+#define EVENT_QUEUE_H
+
+#include "Sim_Defs.h"
+#include "Sim_Event.h"
+#include "Object_Pool.h"
+
+namespace MQSimEngine
+{
+	enum class Event_Queue_Type { RED_BLACK_TREE, CALENDAR_QUEUE };
+
+	class EventTreeNode
+	{
+	public:
+		// key provided by the calling class
+		sim_time_type Key;
+		// the data or value associated with the key
+		Sim_Event* FirstSimEvent;
+		Sim_Event* LastSimEvent;
+		// color - used to balance the tree
+		/*RED = 0 , BLACK = 1;*/
+		int Color;
+		// left node
+		EventTreeNode* Left;
+		// right node (the calendar queue uses it to chain the nodes of a bucket)
+		EventTreeNode* Right;
+		// parent node
+		EventTreeNode* Parent;
+
+		EventTreeNode()
+		{
+			Color = 0;
+			Left = NULL;
+			Right = NULL;
+			Parent = NULL;
+		}
+	};
+
+	/*
+	* The pending event set of the engine. All the events with the same fire time are
+	* chained in a single EventTreeNode, and the engine always consumes the node with
+	* the minimum key, executes its events, and then removes it from the queue.
+	*/
+	class EventQueue
+	{
+	public:
+		EventQueue(Object_Pool<EventTreeNode>& node_pool) : Count(0), node_pool(node_pool) {}
+		virtual ~EventQueue() {}
+
+		// the number of nodes (i.e., distinct fire times) contained in the queue
+		int Count;
+		virtual void Insert_sim_event(Sim_Event* data) = 0;
+		virtual EventTreeNode* Get_min_node() = 0;
+		// returns the node that holds the events with the given fire time, or NULL if there is none
+		virtual EventTreeNode* Find_node(sim_time_type key) = 0;
+		virtual void Remove(EventTreeNode* node) = 0;
+		virtual void Clear() = 0;
+	protected:
+		// the nodes are allocated from the engine's pool, which recycles them across the queue lifetime
+		Object_Pool<EventTreeNode>& node_pool;
+	};
+}
+
+#endif // !EVENT_QUEUE_H
@@ -6,9 +6,9 @@ namespace MQSimEngine
 {
 	class Engine;
 
-	EventTreeNode* EventTree::SentinelNode = NULL;
+	thread_local EventTreeNode* EventTree::SentinelNode = NULL;
 
-	EventTree::EventTree()
+	EventTree::EventTree(Object_Pool<EventTreeNode>& node_pool) : EventQueue(node_pool)
 	{
 		// set up the sentinel node. the sentinel node is the key to a successfull
 		// implementation and for understanding the red-black tree properties.
@@ -37,7 +37,7 @@ namespace MQSimEngine
 	{
 		// traverse tree - find where node belongs
 		// create new node
-		EventTreeNode* node = new EventTreeNode();
+		EventTreeNode* node = node_pool.Allocate();
 		// grab the rbTree node of the tree
 		EventTreeNode* temp = rbTree;
 
@@ -240,6 +240,26 @@ namespace MQSimEngine
 		return NULL;
 	}
 
+	///<summary>
+	/// Find_node
+	/// Returns the node associated with the specified key
+	///<summary>
+	EventTreeNode* EventTree::Find_node(sim_time_type key)
+	{
+		EventTreeNode* treeNode = rbTree;
+		while (treeNode != SentinelNode) {
+			if (key == treeNode->Key) {
+				return treeNode;
+			}
+			if (key < treeNode->Key) {
+				treeNode = treeNode->Left;
+			} else {
+				treeNode = treeNode->Right;
+			}
+		}
+		return NULL;
+	}
+
 	void EventTree::Insert_sim_event(Sim_Event* event)
 	{
 		if (event->Fire_time < Engine::Instance()->Time()) {
@@ -405,7 +425,8 @@ namespace MQSimEngine
 			Restore_after_delete(x);
 
 		lastNodeFound = SentinelNode;
-		delete z;
+		// y has been unlinked from the tree (z now holds its contents if they differ)
+		node_pool.Release(y);
 	}
 
 	///<summary>
@@ -3,46 +3,18 @@
 
 #include "Sim_Defs.h"
 #include "Sim_Event.h"
+#include "EventQueue.h"
 
 namespace MQSimEngine
 {
-	class EventTreeNode
+	class EventTree : public EventQueue
 	{
 	public:
-		// key provided by the calling class
-		sim_time_type Key;
-		// the data or value associated with the key
-		Sim_Event* FirstSimEvent;
-		Sim_Event* LastSimEvent;
-		// color - used to balance the tree
-		/*RED = 0 , BLACK = 1;*/
-		int Color;
-		// left node 
-		EventTreeNode* Left;
-		// right node 
-		EventTreeNode* Right;
-		// parent node 
-		EventTreeNode* Parent;
-
-		EventTreeNode()
-		{
-			Color = 0;
-			Left = NULL;
-			Right = NULL;
-			Parent = NULL;
-		}
-	};
-
-	class EventTree
-	{
-	public:
-		EventTree();
+		EventTree(Object_Pool<EventTreeNode>& node_pool);
 		~EventTree();
 
-		// the number of nodes contained in the tree
-		int Count;
 		//  sentinelNode is convenient way of indicating a leaf node.
-		static EventTreeNode* SentinelNode;
+		static thread_local EventTreeNode* SentinelNode;
 		void Add(sim_time_type key, Sim_Event* data);
 		void RotateLeft(EventTreeNode* x);
 		void RotateRight(EventTreeNode* x);
@@ -51,6 +23,7 @@ namespace MQSimEngine
 		sim_time_type Get_min_key();
 		Sim_Event* Get_min_value();
 		EventTreeNode* Get_min_node();
+		EventTreeNode* Find_node(sim_time_type key);
 		void Remove(sim_time_type key);
 		void Remove(EventTreeNode* node);
 		void Remove_min();
@@ -0,0 +1,76 @@
+#include <algorithm>
+#include <vector>
+#include "Event_Profiler.h"
+
+namespace MQSimEngine
+{
+	static double to_microseconds(std::chrono::steady_clock::duration d)
+	{
+		return std::chrono::duration<double, std::micro>(d).count();
+	}
+
+	void Event_Profiler::Clear()
+	{
+		profiles.clear();
+	}
+
+	void Event_Profiler::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
+	{
+		std::string tmp = name_prefix + ".Event_Profile";
+		xmlwriter.Write_open_tag(tmp);
+
+		for (auto& profile : profiles) {
+			for (auto& type : profile.second.Per_event_type) {
+				xmlwriter.Write_start_element_tag(tmp + ".Entry");
+
+				std::string attr = "Object";
+				std::string val = profile.second.Object_id;
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Event_Type";
+				val = std::to_string(type.first);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Event_Count";
+				val = std::to_string(type.second.Count);
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				attr = "Wall_Time_us";
+				val = std::to_string(to_microseconds(type.second.Wall_time));
+				xmlwriter.Write_attribute_string_inline(attr, val);
+
+				xmlwriter.Write_end_element_tag();
+			}
+		}
+
+		xmlwriter.Write_close_tag();
+	}
+
+	//Prints the objects in the descending order of the wall-clock time spent in their event handlers
+	void Event_Profiler::Print_summary(std::ostream& os)
+	{
+		std::vector<std::pair<std::chrono::steady_clock::duration, const Sim_Object_Profile*>> sorted_profiles;
+		std::chrono::steady_clock::duration total_time(0);
+		for (auto& profile : profiles) {
+			std::chrono::steady_clock::duration object_time(0);
+			for (auto& type : profile.second.Per_event_type) {
+				object_time += type.second.Wall_time;
+			}
+			total_time += object_time;
+			sorted_profiles.push_back(std::make_pair(object_time, &profile.second));
+		}
+		std::sort(sorted_profiles.begin(), sorted_profiles.end(),
+			[](const std::pair<std::chrono::steady_clock::duration, const Sim_Object_Profile*>& a,
+				const std::pair<std::chrono::steady_clock::duration, const Sim_Object_Profile*>& b) { return a.first > b.first; });
+
+		os << "Event profile - total wall time in event handlers: " << to_microseconds(total_time) << " (us)" << std::endl;
+		for (auto& profile : sorted_profiles) {
+			double share = total_time.count() == 0 ? 0 : 100.0 * profile.first.count() / total_time.count();
+			os << "              - " << profile.second->Object_id << ": " << to_microseconds(profile.first) << " (us), " << share << "%" << std::endl;
+			for (auto& type : profile.second->Per_event_type) {
+				os << "                  event type " << type.first << " - count: " << type.second.Count
+					<< " wall time: " << to_microseconds(type.second.Wall_time) << " (us)" << std::endl;
+			}
+		}
+	}
+}
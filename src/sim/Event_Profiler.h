@@ -0,0 +1,54 @@
+#ifndef EVENT_PROFILER_H
+#define EVENT_PROFILER_H
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include "Sim_Defs.h"
+#include "Sim_Object.h"
+#include "Sim_Reporter.h"
+
+namespace MQSimEngine
+{
+	struct Event_Profile_Entry
+	{
+		unsigned long long Count;
+		std::chrono::steady_clock::duration Wall_time;//The cumulative wall-clock time spent in Execute_simulator_event
+	};
+
+	struct Sim_Object_Profile
+	{
+		sim_object_id_type Object_id;
+		std::map<int, Event_Profile_Entry> Per_event_type;
+	};
+
+	/*
+	* Records, for each simulation object and event type, how many events are executed and how
+	* much wall-clock time is spent in their Execute_simulator_event handlers. It is used to find
+	* out which component dominates the execution time of a simulation run.
+	*/
+	class Event_Profiler : public Sim_Reporter
+	{
+	public:
+		void Record(Sim_Object* target, int type, std::chrono::steady_clock::duration wall_time)
+		{
+			auto itr = profiles.find(target);
+			if (itr == profiles.end()) {
+				itr = profiles.insert(std::make_pair(target, Sim_Object_Profile())).first;
+				itr->second.Object_id = target->ID();
+			}
+			Event_Profile_Entry& entry = itr->second.Per_event_type[type];
+			entry.Count++;
+			entry.Wall_time += wall_time;
+		}
+		void Clear();
+		void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter);
+		void Print_summary(std::ostream& os);
+	private:
+		std::unordered_map<Sim_Object*, Sim_Object_Profile> profiles;
+	};
+}
+
+#endif // !EVENT_PROFILER_H
@@ -0,0 +1,105 @@
+#ifndef OBJECT_POOL_H
+#define OBJECT_POOL_H
+
+#include <cstdlib>
+#include <new>
+#include <vector>
+#include <utility>
+#include <type_traits>
+
+#define OBJECT_POOL_CHUNK_SIZE 4096 //The number of objects that are allocated from the heap at once
+
+namespace MQSimEngine
+{
+	/*
+	* A slab allocator with a free list for the small objects that the engine creates and destroys
+	* at a very high rate (i.e., Sim_Event and EventTreeNode). Objects are carved out of large chunks,
+	* released objects are recycled through the free list, and Reset() makes all the chunks available
+	* again without returning them to the heap, so that consecutive simulation scenarios reuse them.
+	*/
+	template <typename T>
+	class Object_Pool
+	{
+		static_assert(std::is_trivially_destructible<T>::value, "Object_Pool does not call the destructors of the pooled objects");
+	public:
+		Object_Pool() : current_chunk(0), next_free_slot(OBJECT_POOL_CHUNK_SIZE), allocation_requests(0), heap_allocations(0) {}
+
+		~Object_Pool()
+		{
+			for (auto chunk : chunks) {
+				std::free(chunk);
+			}
+		}
+
+		template <typename... Args>
+		T* Allocate(Args&&... args)
+		{
+			allocation_requests++;
+			void* slot;
+			if (!free_list.empty()) {
+				slot = free_list.back();
+				free_list.pop_back();
+			} else {
+				if (next_free_slot == OBJECT_POOL_CHUNK_SIZE) {
+					allocate_chunk();
+				}
+				slot = chunks[current_chunk] + next_free_slot * sizeof(T);
+				next_free_slot++;
+			}
+
+			return new (slot) T(std::forward<Args>(args)...);
+		}
+
+		void Release(T* obj)
+		{
+			free_list.push_back(obj);
+		}
+
+		//All the objects that are allocated from the pool become invalid
+		void Reset()
+		{
+			free_list.clear();
+			current_chunk = 0;
+			next_free_slot = chunks.empty() ? OBJECT_POOL_CHUNK_SIZE : 0;
+			allocation_requests = 0;
+			heap_allocations = 0;
+		}
+
+		unsigned long long Get_allocation_requests() const
+		{
+			return allocation_requests;
+		}
+
+		//The number of heap allocations that are avoided compared to allocating each object individually
+		unsigned long long Get_saved_heap_allocations() const
+		{
+			return allocation_requests - heap_allocations;
+		}
+	private:
+		std::vector<char*> chunks;
+		std::vector<T*> free_list;
+		size_t current_chunk;
+		size_t next_free_slot;
+		unsigned long long allocation_requests;
+		unsigned long long heap_allocations;
+
+		void allocate_chunk()
+		{
+			if (!chunks.empty() && current_chunk + 1 < chunks.size()) {
+				//Reuse a chunk that was allocated before the last Reset
+				current_chunk++;
+			} else {
+				char* chunk = (char*)std::malloc(OBJECT_POOL_CHUNK_SIZE * sizeof(T));
+				if (chunk == NULL) {
+					throw std::bad_alloc();
+				}
+				chunks.push_back(chunk);
+				current_chunk = chunks.size() - 1;
+				heap_allocations++;
+			}
+			next_free_slot = 0;
+		}
+	};
+}
+
+#endif // !OBJECT_POOL_H
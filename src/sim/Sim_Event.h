@@ -1,9 +1,13 @@
 #ifndef SIMULATOR_EVENT_H
 #define SIMULATOR_EVENT_H
 
+#include <cstring>
+#include <type_traits>
 #include "Sim_Defs.h"
 #include "Sim_Object.h"
 
+#define SIM_EVENT_PAYLOAD_SIZE 24 //The size of the inline payload in bytes, large enough for a pointer plus an enum or a Memory_Transfer_Info record
+
 namespace MQSimEngine
 {
 	class Sim_Object;
@@ -18,6 +22,27 @@ namespace MQSimEngine
 		int Type;
 		Sim_Event* Next_event;//Used to store event list in the MQSim's engine
 		bool Ignore;//If true, this event will not be executed
+
+		//The inline payload stores small parameters inside the event itself, so that they need no separate heap allocation
+		template <typename T>
+		void Set_payload(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "The event payload must be trivially copyable");
+			static_assert(sizeof(T) <= SIM_EVENT_PAYLOAD_SIZE, "The event payload does not fit into Sim_Event");
+			std::memcpy(payload, &value, sizeof(T));
+		}
+
+		template <typename T>
+		T Get_payload() const
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "The event payload must be trivially copyable");
+			static_assert(sizeof(T) <= SIM_EVENT_PAYLOAD_SIZE, "The event payload does not fit into Sim_Event");
+			T value;
+			std::memcpy(&value, payload, sizeof(T));
+			return value;
+		}
+	private:
+		alignas(8) char payload[SIM_EVENT_PAYLOAD_SIZE];
 	};
 }
 
@@ -41,6 +41,10 @@ namespace MQSimEngine
 		}
 		
 		virtual void Execute_simulator_event(Sim_Event*) = 0;
+
+		//Invoked once after all the events of the current simulation time are executed, if the object has requested it
+		//through Engine::Register_end_of_timestep_callback. It is used to batch the work that is triggered by several events of the same time.
+		virtual void Execute_end_of_timestep_callback() {}
 		 
 	private:
 		sim_object_id_type _id;
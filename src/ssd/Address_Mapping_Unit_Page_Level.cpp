@@ -163,6 +163,44 @@ namespace SSD_Components
 		it->second->Dirty = false;
 	}
 
+	void Cached_Mapping_Table::Save_checkpoint(Utils::Checkpoint_Writer& writer)
+	{
+		writer.Write((uint64_t)lruList.size());
+		for (auto& entry : lruList) {
+			writer.Write(entry.first);
+			writer.Write(entry.second->PPA);
+			writer.Write(entry.second->WrittenStateBitmap);
+			writer.Write(entry.second->Dirty);
+			writer.Write(entry.second->Status);
+			writer.Write(entry.second->Stream_id);
+		}
+	}
+
+	void Cached_Mapping_Table::Load_checkpoint(Utils::Checkpoint_Reader& reader)
+	{
+		for (auto& entry : addressMap) {
+			delete entry.second;
+		}
+		addressMap.clear();
+		lruList.clear();
+
+		uint64_t count;
+		reader.Read(count);
+		for (uint64_t i = 0; i < count; i++) {
+			LPA_type key;
+			CMTSlotType* slot = new CMTSlotType;
+			reader.Read(key);
+			reader.Read(slot->PPA);
+			reader.Read(slot->WrittenStateBitmap);
+			reader.Read(slot->Dirty);
+			reader.Read(slot->Status);
+			reader.Read(slot->Stream_id);
+			lruList.push_back(std::pair<LPA_type, CMTSlotType*>(key, slot));
+			slot->listPtr = std::prev(lruList.end());
+			addressMap[key] = slot;
+		}
+	}
+
 
 	AddressMappingDomain::AddressMappingDomain(unsigned int cmt_capacity, unsigned int cmt_entry_size, unsigned int no_of_translation_entries_per_page,
 		Cached_Mapping_Table* CMT,
@@ -288,7 +326,7 @@ namespace SSD_Components
 		}
 	}
 
-	Address_Mapping_Unit_Page_Level* Address_Mapping_Unit_Page_Level::_my_instance = NULL;
+	thread_local Address_Mapping_Unit_Page_Level* Address_Mapping_Unit_Page_Level::_my_instance = NULL;
 	Address_Mapping_Unit_Page_Level::Address_Mapping_Unit_Page_Level(const sim_object_id_type& id, FTL* ftl, NVM_PHY_ONFI* flash_controller, Flash_Block_Manager_Base* block_manager,
 		bool ideal_mapping_table, unsigned int cmt_capacity_in_byte, Flash_Plane_Allocation_Scheme_Type PlaneAllocationScheme,
 		unsigned int concurrent_stream_no,
@@ -441,6 +479,40 @@ namespace SSD_Components
 		mapping_table_stored_on_flash = true;
 	}
 
+	void Address_Mapping_Unit_Page_Level::Save_checkpoint(Utils::Checkpoint_Writer& writer)
+	{
+		writer.Write(mapping_table_stored_on_flash);
+		for (unsigned int stream_id = 0; stream_id < no_of_input_streams; stream_id++) {
+			writer.Write_array(domains[stream_id]->GlobalTranslationDirectory, domains[stream_id]->Total_translation_pages_no + 1);
+			writer.Write_array(domains[stream_id]->GlobalMappingTable, domains[stream_id]->Total_logical_pages_no);
+			writer.Write(domains[stream_id]->No_of_inserted_entries_in_preconditioning);
+			bool cmt_already_stored = false;
+			for (unsigned int i = 0; i < stream_id; i++) {
+				cmt_already_stored |= domains[i]->CMT == domains[stream_id]->CMT;
+			}
+			if (!cmt_already_stored) {
+				domains[stream_id]->CMT->Save_checkpoint(writer);
+			}
+		}
+	}
+
+	void Address_Mapping_Unit_Page_Level::Load_checkpoint(Utils::Checkpoint_Reader& reader)
+	{
+		reader.Read(mapping_table_stored_on_flash);
+		for (unsigned int stream_id = 0; stream_id < no_of_input_streams; stream_id++) {
+			reader.Read_array(domains[stream_id]->GlobalTranslationDirectory, domains[stream_id]->Total_translation_pages_no + 1);
+			reader.Read_array(domains[stream_id]->GlobalMappingTable, domains[stream_id]->Total_logical_pages_no);
+			reader.Read(domains[stream_id]->No_of_inserted_entries_in_preconditioning);
+			bool cmt_already_loaded = false;
+			for (unsigned int i = 0; i < stream_id; i++) {
+				cmt_already_loaded |= domains[i]->CMT == domains[stream_id]->CMT;
+			}
+			if (!cmt_already_loaded) {
+				domains[stream_id]->CMT->Load_checkpoint(reader);
+			}
+		}
+	}
+
 	int Address_Mapping_Unit_Page_Level::Bring_to_CMT_for_preconditioning(stream_id_type stream_id, LPA_type lpa)
 	{
 		if (domains[stream_id]->GlobalMappingTable[lpa].PPA == NO_PPA) {
@@ -38,7 +38,7 @@ namespace SSD_Components
 		void Set_host_interface(Host_Interface_Base* host_interface);
 		virtual void Do_warmup(std::vector<Utils::Workload_Statistics*> workload_stats) = 0;
 	protected:
-		static Data_Cache_Manager_Base* _my_instance;
+		static thread_local Data_Cache_Manager_Base* _my_instance;
 		Host_Interface_Base* host_interface;
 		NVM_Firmware* nvm_firmware;
 		unsigned int dram_row_size;//The size of the DRAM rows in bytes
@@ -47,7 +47,7 @@ namespace SSD_Components
 		double dram_burst_transfer_time_ddr;//The transfer time of two bursts, changed from sim_time_type to double to increase precision
 		sim_time_type dram_tRCD, dram_tCL, dram_tRP;//DRAM access parameters in nano-seconds
 		Cache_Sharing_Mode sharing_mode;
-		static Caching_Mode* caching_mode_per_input_stream;
+		static thread_local Caching_Mode* caching_mode_per_input_stream;
 		unsigned int stream_count;
 
 		std::vector<UserRequestServicedSignalHanderType> connected_user_request_serviced_signal_handlers;
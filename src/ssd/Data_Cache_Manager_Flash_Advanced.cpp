@@ -26,7 +26,7 @@ namespace SSD_Components
 				for (unsigned int i = 0; i < stream_count; i++) {
 					per_stream_cache[i] = sharedCache;
 				}
-				dram_execution_queue = new std::queue<Memory_Transfer_Info*>[1];
+				dram_execution_queue = new std::queue<Memory_Transfer_Info>[1];
 				waiting_user_requests_queue_for_dram_free_slot = new std::list<User_Request*>[1];
 				this->back_pressure_buffer_depth = new unsigned int[1];
 				this->back_pressure_buffer_depth[0] = 0;
@@ -38,7 +38,7 @@ namespace SSD_Components
 				for (unsigned int i = 0; i < stream_count; i++) {
 					per_stream_cache[i] = new Data_Cache_Flash(capacity_in_pages / stream_count);
 				}
-				dram_execution_queue = new std::queue<Memory_Transfer_Info*>[stream_count];
+				dram_execution_queue = new std::queue<Memory_Transfer_Info>[stream_count];
 				waiting_user_requests_queue_for_dram_free_slot = new std::list<User_Request*>[stream_count];
 				this->back_pressure_buffer_depth = new unsigned int[stream_count];
 				for (unsigned int i = 0; i < stream_count; i++) {
@@ -60,10 +60,6 @@ namespace SSD_Components
 			case SSD_Components::Cache_Sharing_Mode::SHARED:
 			{
 				delete per_stream_cache[0];
-				while (dram_execution_queue[0].size()) {
-					delete dram_execution_queue[0].front();
-					dram_execution_queue[0].pop();
-				}
 				for (auto &req : waiting_user_requests_queue_for_dram_free_slot[0]) {
 					delete req;
 				}
@@ -72,10 +68,6 @@ namespace SSD_Components
 			case SSD_Components::Cache_Sharing_Mode::EQUAL_PARTITIONING:
 				for (unsigned int i = 0; i < stream_count; i++) {
 					delete per_stream_cache[i];
-					while (dram_execution_queue[i].size()) {
-						delete dram_execution_queue[i].front();
-						dram_execution_queue[i].pop();
-					}
 					for (auto &req : waiting_user_requests_queue_for_dram_free_slot[i]) {
 						delete req;
 					}
@@ -124,6 +116,10 @@ namespace SSD_Components
 									break;
 								case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
 									break;
+								case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+									break;
+								case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+									break;
 								case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 									break;
 								}
@@ -170,6 +166,10 @@ namespace SSD_Components
 										break;
 									case Utils::Address_Distribution_Type::RANDOM_UNIFORM:
 										break;
+									case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+										break;
+									case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+										break;
 									case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 										break;
 								}
@@ -226,11 +226,11 @@ namespace SSD_Components
 					}
 
 					if (user_request->Sectors_serviced_from_cache > 0) {
-						Memory_Transfer_Info* transfer_info = new Memory_Transfer_Info;
-						transfer_info->Size_in_bytes = user_request->Sectors_serviced_from_cache * SECTOR_SIZE_IN_BYTE;
-						transfer_info->Related_request = user_request;
-						transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED;
-						transfer_info->Stream_id = user_request->Stream_id;
+						Memory_Transfer_Info transfer_info;
+						transfer_info.Size_in_bytes = user_request->Sectors_serviced_from_cache * SECTOR_SIZE_IN_BYTE;
+						transfer_info.Related_request = user_request;
+						transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED;
+						transfer_info.Stream_id = user_request->Stream_id;
 						service_dram_access_request(transfer_info);
 					}
 					if (user_request->Transaction_list.size() > 0) {
@@ -326,21 +326,21 @@ namespace SSD_Components
 
 		//Issue memory read for cache evictions
 		if (evicted_cache_slots->size() > 0) {
-			Memory_Transfer_Info* read_transfer_info = new Memory_Transfer_Info;
-			read_transfer_info->Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
-			read_transfer_info->Related_request = evicted_cache_slots;
-			read_transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
-			read_transfer_info->Stream_id = user_request->Stream_id;
+			Memory_Transfer_Info read_transfer_info;
+			read_transfer_info.Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
+			read_transfer_info.Related_request = evicted_cache_slots;
+			read_transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
+			read_transfer_info.Stream_id = user_request->Stream_id;
 			service_dram_access_request(read_transfer_info);
 		}
 
 		//Issue memory write to write data to DRAM
 		if (dram_write_size_in_sectors) {
-			Memory_Transfer_Info* write_transfer_info = new Memory_Transfer_Info;
-			write_transfer_info->Size_in_bytes = dram_write_size_in_sectors * SECTOR_SIZE_IN_BYTE;
-			write_transfer_info->Related_request = user_request;
-			write_transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED;
-			write_transfer_info->Stream_id = user_request->Stream_id;
+			Memory_Transfer_Info write_transfer_info;
+			write_transfer_info.Size_in_bytes = dram_write_size_in_sectors * SECTOR_SIZE_IN_BYTE;
+			write_transfer_info.Related_request = user_request;
+			write_transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED;
+			write_transfer_info.Stream_id = user_request->Stream_id;
 			service_dram_access_request(write_transfer_info);
 		}
 
@@ -367,6 +367,15 @@ namespace SSD_Components
 			_my_instance->broadcast_user_memory_transaction_serviced_signal(transaction);
 		}
 
+		//User erase transactions are only created by the physical block erase of libmqsim and carry no data for the cache
+		if (transaction->Type == Transaction_Type::ERASE) {
+			transaction->UserIORequest->Transaction_list.remove(transaction);
+			if (_my_instance->is_user_request_finished(transaction->UserIORequest)) {
+				_my_instance->broadcast_user_request_serviced_signal(transaction->UserIORequest);
+			}
+			return;
+		}
+
 		/* This is an update read (a read that is generated for a write request that partially updates page data).
 		*  An update read transaction is issued in Address Mapping Unit, but is consumed in data cache manager.*/
 		if (transaction->Type == Transaction_Type::READ) {
@@ -405,14 +414,14 @@ namespace SSD_Components
 							std::list<NVM_Transaction*>* evicted_cache_slots = new std::list<NVM_Transaction*>;
 							Data_Cache_Slot_Type evicted_slot = ((Data_Cache_Manager_Flash_Advanced*)_my_instance)->per_stream_cache[transaction->Stream_id]->Evict_one_slot_lru();
 							if (evicted_slot.Status == Cache_Slot_Status::DIRTY_NO_FLASH_WRITEBACK) {
-								Memory_Transfer_Info* transfer_info = new Memory_Transfer_Info;
-								transfer_info->Size_in_bytes = count_sector_no_from_status_bitmap(evicted_slot.State_bitmap_of_existing_sectors) * SECTOR_SIZE_IN_BYTE;
+								Memory_Transfer_Info transfer_info;
+								transfer_info.Size_in_bytes = count_sector_no_from_status_bitmap(evicted_slot.State_bitmap_of_existing_sectors) * SECTOR_SIZE_IN_BYTE;
 								evicted_cache_slots->push_back(new NVM_Transaction_Flash_WR(Transaction_Source_Type::USERIO,
-									transaction->Stream_id, transfer_info->Size_in_bytes, evicted_slot.LPA, NULL, IO_Flow_Priority_Class::UNDEFINED, evicted_slot.Content,
+									transaction->Stream_id, transfer_info.Size_in_bytes, evicted_slot.LPA, NULL, IO_Flow_Priority_Class::UNDEFINED, evicted_slot.Content,
 									evicted_slot.State_bitmap_of_existing_sectors, evicted_slot.Timestamp));
-								transfer_info->Related_request = evicted_cache_slots;
-								transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
-								transfer_info->Stream_id = transaction->Stream_id;
+								transfer_info.Related_request = evicted_cache_slots;
+								transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
+								transfer_info.Stream_id = transaction->Stream_id;
 								unsigned int cache_eviction_read_size_in_sectors = count_sector_no_from_status_bitmap(evicted_slot.State_bitmap_of_existing_sectors);
 								int sharing_id = transaction->Stream_id;
 								if (((Data_Cache_Manager_Flash_Advanced*)_my_instance)->shared_dram_request_queue) {
@@ -425,10 +434,11 @@ namespace SSD_Components
 						((Data_Cache_Manager_Flash_Advanced*)_my_instance)->per_stream_cache[transaction->Stream_id]->Insert_read_data(transaction->Stream_id, transaction->LPA,
 							((NVM_Transaction_Flash_RD*)transaction)->Content, ((NVM_Transaction_Flash_RD*)transaction)->DataTimeStamp, ((NVM_Transaction_Flash_RD*)transaction)->read_sectors_bitmap);
 
-						Memory_Transfer_Info* transfer_info = new Memory_Transfer_Info;
-						transfer_info->Size_in_bytes = count_sector_no_from_status_bitmap(((NVM_Transaction_Flash_RD*)transaction)->read_sectors_bitmap) * SECTOR_SIZE_IN_BYTE;
-						transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_CACHE_FINISHED;
-						transfer_info->Stream_id = transaction->Stream_id;
+						Memory_Transfer_Info transfer_info;
+						transfer_info.Size_in_bytes = count_sector_no_from_status_bitmap(((NVM_Transaction_Flash_RD*)transaction)->read_sectors_bitmap) * SECTOR_SIZE_IN_BYTE;
+						transfer_info.Related_request = NULL;
+						transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_CACHE_FINISHED;
+						transfer_info.Stream_id = transaction->Stream_id;
 						((Data_Cache_Manager_Flash_Advanced*)_my_instance)->service_dram_access_request(transfer_info);
 					}
 
@@ -503,11 +513,11 @@ namespace SSD_Components
 						
 						if (cache_eviction_read_size_in_sectors > 0)
 						{
-							Memory_Transfer_Info* read_transfer_info = new Memory_Transfer_Info;
-							read_transfer_info->Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
-							read_transfer_info->Related_request = evicted_cache_slots;
-							read_transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
-							read_transfer_info->Stream_id = transaction->Stream_id;
+							Memory_Transfer_Info read_transfer_info;
+							read_transfer_info.Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
+							read_transfer_info.Related_request = evicted_cache_slots;
+							read_transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
+							read_transfer_info.Stream_id = transaction->Stream_id;
 							((Data_Cache_Manager_Flash_Advanced*)_my_instance)->service_dram_access_request(read_transfer_info);
 						}
 					}*/
@@ -518,53 +528,56 @@ namespace SSD_Components
 		}
 	}
 
-	void Data_Cache_Manager_Flash_Advanced::service_dram_access_request(Memory_Transfer_Info* request_info)
+	void Data_Cache_Manager_Flash_Advanced::service_dram_access_request(const Memory_Transfer_Info& request_info)
 	{
-		if (memory_channel_is_busy) {
-			if(shared_dram_request_queue) {
-				dram_execution_queue[0].push(request_info);
-			} else {
-				dram_execution_queue[request_info->Stream_id].push(request_info);
-			}
+		if(shared_dram_request_queue) {
+			dram_execution_queue[0].push(request_info);
 		} else {
-			Simulator->Register_sim_event(Simulator->Time() + estimate_dram_access_time(request_info->Size_in_bytes, dram_row_size,
-				dram_busrt_size, dram_burst_transfer_time_ddr, dram_tRCD, dram_tCL, dram_tRP),
-				this, request_info, static_cast<int>(request_info->next_event_type));
-			memory_channel_is_busy = true;
-			dram_execution_list_turn = request_info->Stream_id;
+			dram_execution_queue[request_info.Stream_id].push(request_info);
+		}
+		if (!memory_channel_is_busy) {
+			Simulator->Register_end_of_timestep_callback(this);
 		}
 	}
 
 	void Data_Cache_Manager_Flash_Advanced::Execute_simulator_event(MQSimEngine::Sim_Event* ev)
 	{
 		Data_Cache_Simulation_Event_Type eventType = (Data_Cache_Simulation_Event_Type)ev->Type;
-		Memory_Transfer_Info* transfer_info = (Memory_Transfer_Info*)ev->Parameters;
+		Memory_Transfer_Info transfer_info = ev->Get_payload<Memory_Transfer_Info>();
 
 		switch (eventType)
 		{
 			case Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED://A user read is service from DRAM cache
 			case Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED:
-				((User_Request*)(transfer_info)->Related_request)->Sectors_serviced_from_cache -= transfer_info->Size_in_bytes / SECTOR_SIZE_IN_BYTE;
-				if (is_user_request_finished((User_Request*)(transfer_info)->Related_request))
-					broadcast_user_request_serviced_signal(((User_Request*)(transfer_info)->Related_request));
+				((User_Request*)transfer_info.Related_request)->Sectors_serviced_from_cache -= transfer_info.Size_in_bytes / SECTOR_SIZE_IN_BYTE;
+				if (is_user_request_finished((User_Request*)transfer_info.Related_request))
+					broadcast_user_request_serviced_signal(((User_Request*)transfer_info.Related_request));
 				break;
 			case Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED://Reading data from DRAM and writing it back to the flash storage
-				static_cast<FTL*>(nvm_firmware)->Address_Mapping_Unit->Translate_lpa_to_ppa_and_dispatch(*((std::list<NVM_Transaction*>*)(transfer_info->Related_request)));
-				delete (std::list<NVM_Transaction*>*)transfer_info->Related_request;
+				static_cast<FTL*>(nvm_firmware)->Address_Mapping_Unit->Translate_lpa_to_ppa_and_dispatch(*((std::list<NVM_Transaction*>*)(transfer_info.Related_request)));
+				delete (std::list<NVM_Transaction*>*)transfer_info.Related_request;
 				break;
 			case Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_CACHE_FINISHED://The recently read data from flash is written back to memory to support future user read requests
 				break;
 		}
-		delete transfer_info;
 
 		memory_channel_is_busy = false;
+		Simulator->Register_end_of_timestep_callback(this);
+	}
+
+	void Data_Cache_Manager_Flash_Advanced::Execute_end_of_timestep_callback()
+	{
+		if (memory_channel_is_busy) {
+			return;
+		}
+
 		if (shared_dram_request_queue)	{
 			if (dram_execution_queue[0].size() > 0)	{
-				Memory_Transfer_Info* transfer_info = dram_execution_queue[0].front();
+				Memory_Transfer_Info transfer_info = dram_execution_queue[0].front();
 				dram_execution_queue[0].pop();
-				Simulator->Register_sim_event(Simulator->Time() + estimate_dram_access_time(transfer_info->Size_in_bytes, dram_row_size, dram_busrt_size,
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_dram_access_time(transfer_info.Size_in_bytes, dram_row_size, dram_busrt_size,
 					dram_burst_transfer_time_ddr, dram_tRCD, dram_tCL, dram_tRP),
-					this, transfer_info, static_cast<int>(transfer_info->next_event_type));
+					this, transfer_info, static_cast<int>(transfer_info.next_event_type));
 				memory_channel_is_busy = true;
 			}
 		} else {
@@ -572,11 +585,11 @@ namespace SSD_Components
 				dram_execution_list_turn++;
 				dram_execution_list_turn %= stream_count;
 				if (dram_execution_queue[dram_execution_list_turn].size() > 0) {
-					Memory_Transfer_Info* transfer_info = dram_execution_queue[dram_execution_list_turn].front();
+					Memory_Transfer_Info transfer_info = dram_execution_queue[dram_execution_list_turn].front();
 					dram_execution_queue[dram_execution_list_turn].pop();
-					Simulator->Register_sim_event(Simulator->Time() + estimate_dram_access_time(transfer_info->Size_in_bytes, dram_row_size, dram_busrt_size,
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_dram_access_time(transfer_info.Size_in_bytes, dram_row_size, dram_busrt_size,
 						dram_burst_transfer_time_ddr, dram_tRCD, dram_tCL, dram_tRP),
-						this, transfer_info, static_cast<int>(transfer_info->next_event_type));
+						this, transfer_info, static_cast<int>(transfer_info.next_event_type));
 					memory_channel_is_busy = true;
 					break;
 				}
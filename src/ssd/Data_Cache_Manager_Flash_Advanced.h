@@ -36,6 +36,7 @@ namespace SSD_Components
 			unsigned int stream_count, unsigned int sector_no_per_page, unsigned int back_pressure_buffer_max_depth);
 		~Data_Cache_Manager_Flash_Advanced();
 		void Execute_simulator_event(MQSimEngine::Sim_Event* ev);
+		void Execute_end_of_timestep_callback();//Starts the next DRAM transfer, once all the transfers that are requested at the current time are queued
 		void Setup_triggers();
 		void Do_warmup(std::vector<Utils::Workload_Statistics*> workload_stats);
 	private:
@@ -47,7 +48,7 @@ namespace SSD_Components
 		
 		void process_new_user_request(User_Request* user_request);
 		void write_to_destage_buffer(User_Request* user_request);//Used in the WRITE_CACHE and WRITE_READ_CACHE modes in which the DRAM space is used as a destage buffer
-		std::queue<Memory_Transfer_Info*>* dram_execution_queue;//The list of DRAM transfers that are waiting to be executed
+		std::queue<Memory_Transfer_Info>* dram_execution_queue;//The list of DRAM transfers that are waiting to be executed
 		std::list<User_Request*>* waiting_user_requests_queue_for_dram_free_slot;//The list of user requests that are waiting for free space in DRAM
 		bool shared_dram_request_queue;
 		int dram_execution_list_turn;
@@ -58,7 +59,7 @@ namespace SSD_Components
 		sim_time_type next_bloom_filter_reset_milestone = 0;
 
 		static void handle_transaction_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction);
-		void service_dram_access_request(Memory_Transfer_Info* request_info);
+		void service_dram_access_request(const Memory_Transfer_Info& request_info);
 	};
 }
 
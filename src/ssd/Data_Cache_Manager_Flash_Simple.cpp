@@ -16,7 +16,7 @@ namespace SSD_Components
 	{
 		capacity_in_pages = capacity_in_bytes / (SECTOR_SIZE_IN_BYTE * sector_no_per_page);
 		data_cache = new Data_Cache_Flash(capacity_in_pages);
-		dram_execution_queue = new std::queue<Memory_Transfer_Info*>[stream_count];
+		dram_execution_queue = new std::queue<Memory_Transfer_Info>[stream_count];
 		waiting_user_requests_queue_for_dram_free_slot = new std::list<User_Request*>[stream_count];
 		this->back_pressure_buffer_depth = 0;
 		bloom_filter = new std::set<LPA_type>[stream_count];
@@ -25,10 +25,6 @@ namespace SSD_Components
 	Data_Cache_Manager_Flash_Simple::~Data_Cache_Manager_Flash_Simple()
 	{
 		for (unsigned int i = 0; i < stream_count; i++) {
-			while (dram_execution_queue[i].size()) {
-				delete dram_execution_queue[i].front();
-				dram_execution_queue[i].pop();
-			}
 			for (auto &req : waiting_user_requests_queue_for_dram_free_slot[i]) {
 				delete req;
 			}
@@ -86,11 +82,11 @@ namespace SSD_Components
 						}
 					}
 					if (user_request->Sectors_serviced_from_cache > 0) {
-						Memory_Transfer_Info* transfer_info = new Memory_Transfer_Info;
-						transfer_info->Size_in_bytes = user_request->Sectors_serviced_from_cache * SECTOR_SIZE_IN_BYTE;
-						transfer_info->Related_request = user_request;
-						transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED;
-						transfer_info->Stream_id = user_request->Stream_id;
+						Memory_Transfer_Info transfer_info;
+						transfer_info.Size_in_bytes = user_request->Sectors_serviced_from_cache * SECTOR_SIZE_IN_BYTE;
+						transfer_info.Related_request = user_request;
+						transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED;
+						transfer_info.Stream_id = user_request->Stream_id;
 						service_dram_access_request(transfer_info);
 					}
 					if (user_request->Transaction_list.size() > 0) {
@@ -175,21 +171,21 @@ namespace SSD_Components
 
 		//Issue memory read for cache evictions
 		if (evicted_cache_slots->size() > 0) {
-			Memory_Transfer_Info* read_transfer_info = new Memory_Transfer_Info;
-			read_transfer_info->Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
-			read_transfer_info->Related_request = evicted_cache_slots;
-			read_transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
-			read_transfer_info->Stream_id = user_request->Stream_id;
+			Memory_Transfer_Info read_transfer_info;
+			read_transfer_info.Size_in_bytes = cache_eviction_read_size_in_sectors * SECTOR_SIZE_IN_BYTE;
+			read_transfer_info.Related_request = evicted_cache_slots;
+			read_transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED;
+			read_transfer_info.Stream_id = user_request->Stream_id;
 			service_dram_access_request(read_transfer_info);
 		}
 
 		//Issue memory write to write data to DRAM
 		if (dram_write_size_in_sectors) {
-			Memory_Transfer_Info* write_transfer_info = new Memory_Transfer_Info;
-			write_transfer_info->Size_in_bytes = dram_write_size_in_sectors * SECTOR_SIZE_IN_BYTE;
-			write_transfer_info->Related_request = user_request;
-			write_transfer_info->next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED;
-			write_transfer_info->Stream_id = user_request->Stream_id;
+			Memory_Transfer_Info write_transfer_info;
+			write_transfer_info.Size_in_bytes = dram_write_size_in_sectors * SECTOR_SIZE_IN_BYTE;
+			write_transfer_info.Related_request = user_request;
+			write_transfer_info.next_event_type = Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED;
+			write_transfer_info.Stream_id = user_request->Stream_id;
 			service_dram_access_request(write_transfer_info);
 		}
 
@@ -214,6 +210,15 @@ namespace SSD_Components
 
 		if (transaction->Source == Transaction_Source_Type::USERIO)
 			_my_instance->broadcast_user_memory_transaction_serviced_signal(transaction);
+		//User erase transactions are only created by the physical block erase of libmqsim and carry no data for the cache
+		if (transaction->Type == Transaction_Type::ERASE) {
+			transaction->UserIORequest->Transaction_list.remove(transaction);
+			if (_my_instance->is_user_request_finished(transaction->UserIORequest)) {
+				_my_instance->broadcast_user_request_serviced_signal(transaction->UserIORequest);
+			}
+			return;
+		}
+
 		/* This is an update read (a read that is generated for a write request that partially updates page data).
 		*  An update read transaction is issued in Address Mapping Unit, but is consumed in data cache manager.*/
 		if (transaction->Type == Transaction_Type::READ) {
@@ -278,46 +283,44 @@ namespace SSD_Components
 		}
 	}
 
-	void Data_Cache_Manager_Flash_Simple::service_dram_access_request(Memory_Transfer_Info* request_info)
+	void Data_Cache_Manager_Flash_Simple::service_dram_access_request(const Memory_Transfer_Info& request_info)
 	{
-		dram_execution_queue[request_info->Stream_id].push(request_info);
-		if(dram_execution_queue[request_info->Stream_id].size() == 1) {
-			Simulator->Register_sim_event(Simulator->Time() + estimate_dram_access_time(request_info->Size_in_bytes, dram_row_size,
+		dram_execution_queue[request_info.Stream_id].push(request_info);
+		if(dram_execution_queue[request_info.Stream_id].size() == 1) {
+			Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_dram_access_time(request_info.Size_in_bytes, dram_row_size,
 				dram_busrt_size, dram_burst_transfer_time_ddr, dram_tRCD, dram_tCL, dram_tRP),
-				this, request_info, static_cast<int>(request_info->next_event_type));
+				this, request_info, static_cast<int>(request_info.next_event_type));
 		}
 	}
 
 	void Data_Cache_Manager_Flash_Simple::Execute_simulator_event(MQSimEngine::Sim_Event* ev)
 	{
 		Data_Cache_Simulation_Event_Type eventType = (Data_Cache_Simulation_Event_Type)ev->Type;
-		Memory_Transfer_Info* transfer_inf = (Memory_Transfer_Info*)ev->Parameters;
+		Memory_Transfer_Info transfer_inf = ev->Get_payload<Memory_Transfer_Info>();
 
 		switch (eventType)
 			{
 			case Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_USERIO_FINISHED://A user read is service from DRAM cache
 			case Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_USERIO_FINISHED:
-				((User_Request*)(transfer_inf)->Related_request)->Sectors_serviced_from_cache -= transfer_inf->Size_in_bytes / SECTOR_SIZE_IN_BYTE;
-				if (is_user_request_finished((User_Request*)(transfer_inf)->Related_request)) {
-					broadcast_user_request_serviced_signal(((User_Request*)(transfer_inf)->Related_request));
+				((User_Request*)transfer_inf.Related_request)->Sectors_serviced_from_cache -= transfer_inf.Size_in_bytes / SECTOR_SIZE_IN_BYTE;
+				if (is_user_request_finished((User_Request*)transfer_inf.Related_request)) {
+					broadcast_user_request_serviced_signal(((User_Request*)transfer_inf.Related_request));
 				}
 				break;
 			case Data_Cache_Simulation_Event_Type::MEMORY_READ_FOR_CACHE_EVICTION_FINISHED://Reading data from DRAM and writing it back to the flash storage
-				static_cast<FTL*>(nvm_firmware)->Address_Mapping_Unit->Translate_lpa_to_ppa_and_dispatch(*((std::list<NVM_Transaction*>*)(transfer_inf->Related_request)));
-				delete (std::list<NVM_Transaction*>*)transfer_inf->Related_request;
+				static_cast<FTL*>(nvm_firmware)->Address_Mapping_Unit->Translate_lpa_to_ppa_and_dispatch(*((std::list<NVM_Transaction*>*)(transfer_inf.Related_request)));
+				delete (std::list<NVM_Transaction*>*)transfer_inf.Related_request;
 				break;
 			case Data_Cache_Simulation_Event_Type::MEMORY_WRITE_FOR_CACHE_FINISHED://The recently read data from flash is written back to memory to support future user read requests
 				break;
 		}
 
-		dram_execution_queue[transfer_inf->Stream_id].pop();
-		if (dram_execution_queue[transfer_inf->Stream_id].size() > 0) {
-			Memory_Transfer_Info* new_transfer_info = dram_execution_queue[transfer_inf->Stream_id].front();
-			Simulator->Register_sim_event(Simulator->Time() + estimate_dram_access_time(new_transfer_info->Size_in_bytes, dram_row_size, dram_busrt_size,
+		dram_execution_queue[transfer_inf.Stream_id].pop();
+		if (dram_execution_queue[transfer_inf.Stream_id].size() > 0) {
+			Memory_Transfer_Info& new_transfer_info = dram_execution_queue[transfer_inf.Stream_id].front();
+			Simulator->Register_sim_event_with_payload(Simulator->Time() + estimate_dram_access_time(new_transfer_info.Size_in_bytes, dram_row_size, dram_busrt_size,
 				dram_burst_transfer_time_ddr, dram_tRCD, dram_tCL, dram_tRP),
-				this, new_transfer_info, static_cast<int>(new_transfer_info->next_event_type));
+				this, new_transfer_info, static_cast<int>(new_transfer_info.next_event_type));
 		}
-
-		delete transfer_inf;
 	}
 }
@@ -31,7 +31,7 @@ namespace SSD_Components
 
 		void process_new_user_request(User_Request* user_request);
 		void write_to_destage_buffer(User_Request* user_request);//Used in the WRITE_CACHE and WRITE_READ_CACHE modes in which the DRAM space is used as a destage buffer
-		std::queue<Memory_Transfer_Info*>* dram_execution_queue;//The list of DRAM transfers that are waiting to be executed
+		std::queue<Memory_Transfer_Info>* dram_execution_queue;//The list of DRAM transfers that are waiting to be executed
 		std::list<User_Request*>* waiting_user_requests_queue_for_dram_free_slot;//The list of user requests that are waiting for free space in DRAM
 		int request_queue_turn;
 		unsigned int back_pressure_buffer_max_depth;
@@ -41,7 +41,7 @@ namespace SSD_Components
 		sim_time_type next_bloom_filter_reset_milestone = 0;
 
 		static void handle_transaction_serviced_signal_from_PHY(NVM_Transaction_Flash* transaction);
-		void service_dram_access_request(Memory_Transfer_Info* request_info);
+		void service_dram_access_request(const Memory_Transfer_Info& request_info);
 	};
 }
 
@@ -5,6 +5,7 @@
 #include <map>
 #include <functional>
 #include <iterator>
+#include <algorithm>
 #include "../sim/Sim_Defs.h"
 #include "../utils/DistributionTypes.h"
 #include "../utils/Helper_Functions.h"
@@ -44,6 +45,22 @@ namespace SSD_Components
 		if (this->GC_and_WL_Unit == NULL)
 			throw std::logic_error("The garbage collector is not set for FTL!");
 	}
+	void FTL::Save_checkpoint(Utils::Checkpoint_Writer& writer)
+	{
+		random_generator.Save_checkpoint(writer);
+		writer.Write(preconditioning_seed);
+		Address_Mapping_Unit->Save_checkpoint(writer);
+		BlockManager->Save_checkpoint(writer);
+	}
+
+	void FTL::Load_checkpoint(Utils::Checkpoint_Reader& reader)
+	{
+		random_generator.Load_checkpoint(reader);
+		reader.Read(preconditioning_seed);
+		Address_Mapping_Unit->Load_checkpoint(reader);
+		BlockManager->Load_checkpoint(reader);
+	}
+
 	void FTL::Perform_precondition(std::vector<Utils::Workload_Statistics*> workload_stats)
 	{
 		Address_Mapping_Unit->Store_mapping_table_on_flash_at_start();
@@ -51,27 +68,21 @@ namespace SSD_Components
 		double overall_rate = 0;
 		for (auto const &stat : workload_stats)
 		{
-			if (stat->Type == Utils::Workload_Type::SYNTHETIC)
-			{
-				switch (stat->generator_type)
-				{
-				case Utils::Request_Generator_Type::BANDWIDTH:
-					overall_rate += 1.0 / double(stat->Average_inter_arrival_time_nano_sec) * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
-					break;
-				case Utils::Request_Generator_Type::QUEUE_DEPTH:
-				{
-					sim_time_type max_arrival_time = sim_time_type(stat->Read_ratio * double(avg_flash_read_latency) + (1 - stat->Read_ratio) * double(avg_flash_program_latency));
-					double avg_arrival_time = double(max_arrival_time) / double(stat->Request_queue_depth);
-					overall_rate += 1.0 / avg_arrival_time * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
-					break;
-				}
-				default:
-					PRINT_ERROR("Unknown request type generator in the FTL preconditioning function.")
-				}
-			}
-			else
+			//Trace-based flows report BANDWIDTH when they replay their arrival times, and QUEUE_DEPTH when they replay in a closed loop
+			switch (stat->generator_type)
 			{
+			case Utils::Request_Generator_Type::BANDWIDTH:
 				overall_rate += 1.0 / double(stat->Average_inter_arrival_time_nano_sec) * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
+				break;
+			case Utils::Request_Generator_Type::QUEUE_DEPTH:
+			{
+				sim_time_type max_arrival_time = sim_time_type(stat->Read_ratio * double(avg_flash_read_latency) + (1 - stat->Read_ratio) * double(avg_flash_program_latency)) + stat->Think_time;
+				double avg_arrival_time = double(max_arrival_time) / double(stat->Request_queue_depth);
+				overall_rate += 1.0 / avg_arrival_time * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
+				break;
+			}
+			default:
+				PRINT_ERROR("Unknown request type generator in the FTL preconditioning function.")
 			}
 		}
 
@@ -115,6 +126,9 @@ namespace SSD_Components
 				Utils::RandomGenerator* random_hot_cold_generator = NULL;
 				Utils::RandomGenerator* random_request_size_generator = NULL;
 				bool fully_include_hot_addresses = false;
+				std::vector<std::pair<LHA_type, LHA_type>> skewed_fill_ranges;//Used for Zipfian and multi-tier traffic, in the decreasing order of popularity
+				size_t hot_fill_range_count = 0, skewed_fill_range_index = 0;
+				LHA_type skewed_next_address = 0;
 
 				if (stat->Address_distribution_type == Utils::Address_Distribution_Type::RANDOM_HOTCOLD)//treat a workload with very low hot/cold values as a uniform random workload
 					if (stat->Ratio_of_hot_addresses_to_whole_working_set > 0.3)
@@ -184,6 +198,57 @@ namespace SSD_Components
 					}
 					break;
 				}
+				case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+				case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+				{
+					//Check if enough LPAs could be generated within the working set of the flow
+					if ((max_lpa - min_lpa) < 1.1 * no_of_logical_pages_in_steadystate)
+					{
+						PRINT_MESSAGE("The specified initial occupancy value could not be satisfied as the working set of workload #" << stat->Stream_id << " is small. MQSim made some adjustments!");
+						max_lha = min_lha + LHA_type(double(max_lha - min_lha) / stat->Working_set_ratio);
+						if (stat->generate_aligned_addresses)
+							if (max_lha % stat->alignment_value != 0)
+								max_lha -= min_lha % stat->alignment_value;
+						max_lpa = Convert_host_logical_address_to_device_address(max_lha);
+
+						if ((max_lpa - min_lpa) < 1.1 * no_of_logical_pages_in_steadystate)
+						{
+							no_of_logical_pages_in_steadystate = (unsigned int)(double(max_lpa - min_lpa) * 0.9);
+						}
+					}
+
+					//The most popular addresses are the most likely ones to hold valid data in the steady-state, so they are written first
+					if (decision_dist_type == Utils::Address_Distribution_Type::RANDOM_ZIPFIAN)
+					{
+						LHA_type hot_end_lha = min_lha + (LHA_type)((double)(max_lha - min_lha) * stat->Ratio_of_hot_addresses_to_whole_working_set);
+						skewed_fill_ranges.push_back(std::make_pair(min_lha, hot_end_lha));
+						hot_fill_range_count = 1;
+						if (hot_end_lha < max_lha)
+							skewed_fill_ranges.push_back(std::make_pair(hot_end_lha + 1, max_lha));
+					}
+					else
+					{
+						std::vector<size_t> tiers;
+						std::vector<LHA_type> tier_start_lha;
+						double address_ratio_sum = 0;
+						for (size_t tier = 0; tier < stat->Tier_address_ratios.size(); tier++)
+						{
+							tiers.push_back(tier);
+							tier_start_lha.push_back(min_lha + (LHA_type)((double)(max_lha - min_lha + 1) * address_ratio_sum));
+							address_ratio_sum += stat->Tier_address_ratios[tier];
+							if (stat->Tier_traffic_ratios[tier] > stat->Tier_address_ratios[tier])
+								hot_fill_range_count++;
+						}
+						tier_start_lha.push_back(max_lha + 1);
+						std::stable_sort(tiers.begin(), tiers.end(), [&stat](size_t a, size_t b) {
+							return stat->Tier_traffic_ratios[a] / stat->Tier_address_ratios[a] > stat->Tier_traffic_ratios[b] / stat->Tier_address_ratios[b];
+						});
+						for (auto tier : tiers)
+							skewed_fill_ranges.push_back(std::make_pair(tier_start_lha[tier], tier_start_lha[tier + 1] - 1));
+					}
+					skewed_next_address = skewed_fill_ranges[0].first;
+					break;
+				}
 				case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 					PRINT_ERROR("Not Implemented")
 					break;
@@ -280,6 +345,22 @@ namespace SSD_Components
 						if (start_LBA + size > max_lha)
 							start_LBA = min_lha;
 						break;
+					case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+					case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER:
+						start_LBA = skewed_next_address;
+						if (start_LBA + size > max_lha)
+							start_LBA = min_lha;
+						is_hot_address = skewed_fill_range_index < hot_fill_range_count;
+						skewed_next_address += size;
+						if (skewed_next_address > skewed_fill_ranges[skewed_fill_range_index].second)
+						{
+							skewed_fill_range_index = (skewed_fill_range_index + 1) % skewed_fill_ranges.size();
+							skewed_next_address = skewed_fill_ranges[skewed_fill_range_index].first;
+						}
+						if (stat->generate_aligned_addresses)
+							if (skewed_next_address % stat->alignment_value != 0)
+								skewed_next_address += stat->alignment_value - (skewed_next_address % stat->alignment_value);
+						break;
 					case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 						PRINT_ERROR("Not Implemented")
 						break;
@@ -322,6 +403,16 @@ namespace SSD_Components
 						}
 					}
 				}
+
+				//The steady-state of the skewed distributions is estimated with that of their equivalent hot/cold traffic
+				if (decision_dist_type == Utils::Address_Distribution_Type::RANDOM_ZIPFIAN || decision_dist_type == Utils::Address_Distribution_Type::RANDOM_MULTI_TIER)
+				{
+					if (stat->Ratio_of_hot_addresses_to_whole_working_set > 0
+						&& stat->Ratio_of_traffic_accessing_hot_region > stat->Ratio_of_hot_addresses_to_whole_working_set)
+						decision_dist_type = Utils::Address_Distribution_Type::RANDOM_HOTCOLD;
+					else
+						decision_dist_type = Utils::Address_Distribution_Type::RANDOM_UNIFORM;
+				}
 			} else {
 				//Step 1-1: Read LPAs are preferred for steady-state since each read should be written before the actual access
 				for (auto itr = stat->Write_read_shared_addresses.begin(); itr != stat->Write_read_shared_addresses.end(); itr++) {
@@ -650,23 +741,19 @@ namespace SSD_Components
 				switch (Address_Mapping_Unit->Get_CMT_sharing_mode()) {
 					case CMT_Sharing_Mode::SHARED: {
 						double flow_rate = 0;
-						if (stat->Type == Utils::Workload_Type::SYNTHETIC) {
-							switch (stat->generator_type) {
-								case Utils::Request_Generator_Type::BANDWIDTH:
-									flow_rate = 1.0 / double(stat->Average_inter_arrival_time_nano_sec) * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
-									break;
-								case Utils::Request_Generator_Type::QUEUE_DEPTH:
-								{
-									sim_time_type max_arrival_time = sim_time_type(stat->Read_ratio * double(avg_flash_read_latency) + (1 - stat->Read_ratio) * double(avg_flash_program_latency));
-									double avg_arrival_time = double(max_arrival_time) / double(stat->Request_queue_depth);
-									flow_rate = 1.0 / avg_arrival_time * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
-									break;
-								}
-								default:
-									PRINT_ERROR("Unknown request type generator in the FTL preconditioning function.")
+						switch (stat->generator_type) {
+							case Utils::Request_Generator_Type::BANDWIDTH:
+								flow_rate = 1.0 / double(stat->Average_inter_arrival_time_nano_sec) * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
+								break;
+							case Utils::Request_Generator_Type::QUEUE_DEPTH:
+							{
+								sim_time_type max_arrival_time = sim_time_type(stat->Read_ratio * double(avg_flash_read_latency) + (1 - stat->Read_ratio) * double(avg_flash_program_latency)) + stat->Think_time;
+								double avg_arrival_time = double(max_arrival_time) / double(stat->Request_queue_depth);
+								flow_rate = 1.0 / avg_arrival_time * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
+								break;
 							}
-						} else {
-							flow_rate = 1.0 / double(stat->Average_inter_arrival_time_nano_sec) * SIM_TIME_TO_SECONDS_COEFF * stat->Average_request_size_sector;
+							default:
+								PRINT_ERROR("Unknown request type generator in the FTL preconditioning function.")
 						}
 
 						no_of_entries_in_cmt = (unsigned int)(double(flow_rate) / double(overall_rate) * Address_Mapping_Unit->Get_cmt_capacity());
@@ -754,6 +841,9 @@ namespace SSD_Components
 						}
 						break;
 					}
+					case Utils::Address_Distribution_Type::RANDOM_ZIPFIAN:
+					case Utils::Address_Distribution_Type::RANDOM_MULTI_TIER://Replaced by their equivalent hot/cold or uniform traffic in Step 1
+						break;
 					case Utils::Address_Distribution_Type::MIXED_STREAMING_RANDOM:
 						PRINT_ERROR("Not Implemented")
 						break;
@@ -29,6 +29,8 @@ namespace SSD_Components
 			sim_time_type avg_flash_read_latency, sim_time_type avg_flash_program_latency, double over_provisioning_ratio, unsigned int max_allowed_block_erase_count, int seed);
 		~FTL();
 		void Perform_precondition(std::vector<Utils::Workload_Statistics*> workload_stats);
+		void Save_checkpoint(Utils::Checkpoint_Writer& writer);//Stores the FTL state that is built by Perform_precondition
+		void Load_checkpoint(Utils::Checkpoint_Reader& reader);
 		void Validate_simulation_config();
 		void Start_simulation();
 		void Execute_simulator_event(MQSimEngine::Sim_Event*);
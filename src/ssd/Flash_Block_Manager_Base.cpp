@@ -3,7 +3,7 @@
 
 namespace SSD_Components
 {
-	unsigned int Block_Pool_Slot_Type::Page_vector_size = 0;
+	thread_local unsigned int Block_Pool_Slot_Type::Page_vector_size = 0;
 	Flash_Block_Manager_Base::Flash_Block_Manager_Base(GC_and_WL_Unit_Base* gc_and_wl_unit, unsigned int max_allowed_block_erase_count, unsigned int total_concurrent_streams_no,
 		unsigned int channel_count, unsigned int chip_no_per_channel, unsigned int die_no_per_chip, unsigned int plane_no_per_die,
 		unsigned int block_no_per_plane, unsigned int page_no_per_block)
@@ -241,4 +241,120 @@ namespace SSD_Components
 		}
 		return false;
 	}
+
+	void Flash_Block_Manager_Base::Save_checkpoint(Utils::Checkpoint_Writer& writer)
+	{
+		for (unsigned int channel_id = 0; channel_id < channel_count; channel_id++) {
+			for (unsigned int chip_id = 0; chip_id < chip_no_per_channel; chip_id++) {
+				for (unsigned int die_id = 0; die_id < die_no_per_chip; die_id++) {
+					for (unsigned int plane_id = 0; plane_id < plane_no_per_die; plane_id++) {
+						PlaneBookKeepingType* plane_record = &plane_manager[channel_id][chip_id][die_id][plane_id];
+						writer.Write(plane_record->Total_pages_count);
+						writer.Write(plane_record->Free_pages_count);
+						writer.Write(plane_record->Valid_pages_count);
+						writer.Write(plane_record->Invalid_pages_count);
+						for (unsigned int block_id = 0; block_id < block_no_per_plane; block_id++) {
+							Block_Pool_Slot_Type* block = &plane_record->Blocks[block_id];
+							writer.Write(block->Current_page_write_index);
+							writer.Write(block->Current_status);
+							writer.Write(block->Invalid_page_count);
+							writer.Write(block->Erase_count);
+							writer.Write_array(block->Invalid_page_bitmap, Block_Pool_Slot_Type::Page_vector_size);
+							writer.Write(block->Stream_id);
+							writer.Write(block->Holds_mapping_data);
+							writer.Write(block->Has_ongoing_gc_wl);
+							writer.Write(block->Hot_block);
+							writer.Write(block->Ongoing_user_read_count);
+							writer.Write(block->Ongoing_user_program_count);
+						}
+
+						//The free block pool is stored in its iteration order, so that blocks with equal erase counts are reloaded in the same order
+						writer.Write((uint64_t)plane_record->Free_block_pool.size());
+						for (auto& block : plane_record->Free_block_pool) {
+							writer.Write(block.first);
+							writer.Write(block.second->BlockID);
+						}
+						for (unsigned int stream_id = 0; stream_id < total_concurrent_streams_no; stream_id++) {
+							writer.Write(plane_record->Data_wf[stream_id]->BlockID);
+							writer.Write(plane_record->GC_wf[stream_id]->BlockID);
+							writer.Write(plane_record->Translation_wf[stream_id]->BlockID);
+						}
+						std::queue<flash_block_ID_type> usage_history(plane_record->Block_usage_history);
+						writer.Write((uint64_t)usage_history.size());
+						while (!usage_history.empty()) {
+							writer.Write(usage_history.front());
+							usage_history.pop();
+						}
+						writer.Write((uint64_t)plane_record->Ongoing_erase_operations.size());
+						for (auto block_id : plane_record->Ongoing_erase_operations) {
+							writer.Write(block_id);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void Flash_Block_Manager_Base::Load_checkpoint(Utils::Checkpoint_Reader& reader)
+	{
+		for (unsigned int channel_id = 0; channel_id < channel_count; channel_id++) {
+			for (unsigned int chip_id = 0; chip_id < chip_no_per_channel; chip_id++) {
+				for (unsigned int die_id = 0; die_id < die_no_per_chip; die_id++) {
+					for (unsigned int plane_id = 0; plane_id < plane_no_per_die; plane_id++) {
+						PlaneBookKeepingType* plane_record = &plane_manager[channel_id][chip_id][die_id][plane_id];
+						reader.Read(plane_record->Total_pages_count);
+						reader.Read(plane_record->Free_pages_count);
+						reader.Read(plane_record->Valid_pages_count);
+						reader.Read(plane_record->Invalid_pages_count);
+						for (unsigned int block_id = 0; block_id < block_no_per_plane; block_id++) {
+							Block_Pool_Slot_Type* block = &plane_record->Blocks[block_id];
+							reader.Read(block->Current_page_write_index);
+							reader.Read(block->Current_status);
+							reader.Read(block->Invalid_page_count);
+							reader.Read(block->Erase_count);
+							reader.Read_array(block->Invalid_page_bitmap, Block_Pool_Slot_Type::Page_vector_size);
+							reader.Read(block->Stream_id);
+							reader.Read(block->Holds_mapping_data);
+							reader.Read(block->Has_ongoing_gc_wl);
+							reader.Read(block->Hot_block);
+							reader.Read(block->Ongoing_user_read_count);
+							reader.Read(block->Ongoing_user_program_count);
+							block->Erase_transaction = NULL;
+						}
+
+						uint64_t count;
+						unsigned int erase_count;
+						flash_block_ID_type block_id;
+						plane_record->Free_block_pool.clear();
+						reader.Read(count);
+						for (uint64_t i = 0; i < count; i++) {
+							reader.Read(erase_count);
+							reader.Read(block_id);
+							plane_record->Free_block_pool.insert(std::pair<unsigned int, Block_Pool_Slot_Type*>(erase_count, &plane_record->Blocks[block_id]));
+						}
+						for (unsigned int stream_id = 0; stream_id < total_concurrent_streams_no; stream_id++) {
+							reader.Read(block_id);
+							plane_record->Data_wf[stream_id] = &plane_record->Blocks[block_id];
+							reader.Read(block_id);
+							plane_record->GC_wf[stream_id] = &plane_record->Blocks[block_id];
+							reader.Read(block_id);
+							plane_record->Translation_wf[stream_id] = &plane_record->Blocks[block_id];
+						}
+						plane_record->Block_usage_history = std::queue<flash_block_ID_type>();
+						reader.Read(count);
+						for (uint64_t i = 0; i < count; i++) {
+							reader.Read(block_id);
+							plane_record->Block_usage_history.push(block_id);
+						}
+						plane_record->Ongoing_erase_operations.clear();
+						reader.Read(count);
+						for (uint64_t i = 0; i < count; i++) {
+							reader.Read(block_id);
+							plane_record->Ongoing_erase_operations.insert(block_id);
+						}
+					}
+				}
+			}
+		}
+	}
 }
@@ -8,6 +8,7 @@
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 #include "../nvm_chip/flash_memory/Physical_Page_Address.h"
 #include "GC_and_WL_Unit_Base.h"
+#include "../utils/Checkpoint.h"
 #include "../nvm_chip/flash_memory/FlashTypes.h"
 
 namespace SSD_Components
@@ -34,7 +35,7 @@ namespace SSD_Components
 		Block_Service_Status Current_status;
 		unsigned int Invalid_page_count;
 		unsigned int Erase_count;
-		static unsigned int Page_vector_size;
+		static thread_local unsigned int Page_vector_size;
 		uint64_t* Invalid_page_bitmap;//A bit sequence that keeps track of valid/invalid status of pages in the block. A "0" means valid, and a "1" means invalid.
 		stream_id_type Stream_id = NO_STREAM;
 		bool Holds_mapping_data = false;
@@ -96,6 +97,8 @@ namespace SSD_Components
 		void Program_transaction_serviced(const NVM::FlashMemory::Physical_Page_Address& page_address);//Updates the block bookkeeping record
 		bool Is_having_ongoing_program(const NVM::FlashMemory::Physical_Page_Address& block_address);//Cheks if block has any ongoing program request
 		bool Is_page_valid(Block_Pool_Slot_Type* block, flash_page_ID_type page_id);//Make the page invalid in the block bookkeeping record
+		void Save_checkpoint(Utils::Checkpoint_Writer& writer);//Stores the block bookkeeping records of all planes, e.g., after preconditioning
+		void Load_checkpoint(Utils::Checkpoint_Reader& reader);
 	protected:
 		PlaneBookKeepingType ****plane_manager;//Keeps track of plane block usage information
 		GC_and_WL_Unit_Base *gc_and_wl_unit;
@@ -2,7 +2,7 @@
 
 namespace SSD_Components
 {
-	GC_and_WL_Unit_Base* GC_and_WL_Unit_Base::_my_instance;
+	thread_local GC_and_WL_Unit_Base* GC_and_WL_Unit_Base::_my_instance;
 	
 	GC_and_WL_Unit_Base::GC_and_WL_Unit_Base(const sim_object_id_type& id,
 		Address_Mapping_Unit_Base* address_mapping_unit, Flash_Block_Manager_Base* block_manager, TSU_Base* tsu, NVM_PHY_ONFI* flash_controller,
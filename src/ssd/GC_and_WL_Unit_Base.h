@@ -59,7 +59,7 @@ namespace SSD_Components
 		bool Use_static_wearleveling();
 		bool Stop_servicing_writes(const NVM::FlashMemory::Physical_Page_Address& plane_address);
 	protected:
-		static GC_and_WL_Unit_Base * _my_instance;
+		static thread_local GC_and_WL_Unit_Base * _my_instance;
 		Address_Mapping_Unit_Base* address_mapping_unit;
 		Flash_Block_Manager_Base* block_manager;
 		TSU_Base* tsu;
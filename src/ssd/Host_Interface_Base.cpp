@@ -28,7 +28,7 @@ namespace SSD_Components
 		}
 	}
 
-	Host_Interface_Base* Host_Interface_Base::_my_instance = NULL;
+	thread_local Host_Interface_Base* Host_Interface_Base::_my_instance = NULL;
 
 	Host_Interface_Base::Host_Interface_Base(const sim_object_id_type& id, HostInterface_Types type, LHA_type max_logical_sector_address, unsigned int sectors_per_page, 
 		Data_Cache_Manager_Base* cache)
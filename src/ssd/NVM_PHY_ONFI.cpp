@@ -47,4 +47,22 @@ namespace SSD_Components {
 			(*it)(chip);
 		}
 	}
+
+	void NVM_PHY_ONFI::ConnectToChannelStatusChangeSignal(flash_channel_ID_type channel_id, ChannelStatusChangeHandlerType function)
+	{
+		connectedChannelStatusChangeHandlers[channel_id].push_back(function);
+	}
+
+	//The subscribers of a channel are only notified when its status actually changes, e.g., not on each of several back-to-back die-interleaved transfers
+	void NVM_PHY_ONFI::broadcastChannelStatusChangeSignal(flash_channel_ID_type channel_id, BusChannelStatus status)
+	{
+		if (reportedChannelStatus[channel_id] == status) {
+			return;
+		}
+		reportedChannelStatus[channel_id] = status;
+		for (std::vector<ChannelStatusChangeHandlerType>::iterator it = connectedChannelStatusChangeHandlers[channel_id].begin();
+			it != connectedChannelStatusChangeHandlers[channel_id].end(); it++) {
+			(*it)(channel_id, status);
+		}
+	}
 }
\ No newline at end of file
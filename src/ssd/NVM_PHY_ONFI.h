@@ -22,7 +22,8 @@ namespace SSD_Components
 		NVM_PHY_ONFI(sim_object_id_type id,
 			unsigned int ChannelCount, unsigned int chip_no_per_channel, unsigned int DieNoPerChip, unsigned int PlaneNoPerDie)
 			: NVM_PHY_Base(id),
-			channel_count(ChannelCount), chip_no_per_channel(chip_no_per_channel), die_no_per_chip(DieNoPerChip), plane_no_per_die(PlaneNoPerDie){}
+			channel_count(ChannelCount), chip_no_per_channel(chip_no_per_channel), die_no_per_chip(DieNoPerChip), plane_no_per_die(PlaneNoPerDie),
+			connectedChannelStatusChangeHandlers(ChannelCount), reportedChannelStatus(ChannelCount, BusChannelStatus::IDLE) {}
 		~NVM_PHY_ONFI() {};
 
 		virtual BusChannelStatus Get_channel_status(flash_channel_ID_type) = 0;
@@ -41,6 +42,8 @@ namespace SSD_Components
 		void ConnectToChannelIdleSignal(ChannelIdleHandlerType);
 		typedef void(*ChipIdleHandlerType) (NVM::FlashMemory::Flash_Chip*);
 		void ConnectToChipIdleSignal(ChipIdleHandlerType);
+		typedef void(*ChannelStatusChangeHandlerType) (flash_channel_ID_type, BusChannelStatus);
+		void ConnectToChannelStatusChangeSignal(flash_channel_ID_type channel_id, ChannelStatusChangeHandlerType);
 	protected:
 		unsigned int channel_count;
 		unsigned int chip_no_per_channel;
@@ -52,6 +55,9 @@ namespace SSD_Components
 		void broadcastChannelIdleSignal(flash_channel_ID_type);
 		std::vector<ChipIdleHandlerType> connectedChipIdleHandlers;
 		void broadcastChipIdleSignal(NVM::FlashMemory::Flash_Chip* chip);
+		std::vector<std::vector<ChannelStatusChangeHandlerType>> connectedChannelStatusChangeHandlers;//The subscribers of each channel
+		std::vector<BusChannelStatus> reportedChannelStatus;//The last status of each channel that is delivered to its subscribers
+		void broadcastChannelStatusChangeSignal(flash_channel_ID_type channel_id, BusChannelStatus status);
 	};
 }
 
@@ -5,7 +5,7 @@
 
 namespace SSD_Components {
 	/*hack: using this style to emulate event/delegate*/
-	NVM_PHY_ONFI_NVDDR2* NVM_PHY_ONFI_NVDDR2::_my_instance;
+	thread_local NVM_PHY_ONFI_NVDDR2* NVM_PHY_ONFI_NVDDR2::_my_instance;
 
 	NVM_PHY_ONFI_NVDDR2::NVM_PHY_ONFI_NVDDR2(const sim_object_id_type& id, ONFI_Channel_NVDDR2** channels,
 		unsigned int ChannelCount, unsigned int chip_no_per_channel, unsigned int DieNoPerChip, unsigned int PlaneNoPerDie)
@@ -136,7 +136,7 @@ namespace SSD_Components {
 		ChipBookKeepingEntry* chipBKE = &bookKeepingTable[transaction_list.front()->Address.ChannelID][transaction_list.front()->Address.ChipID];
 		DieBookKeepingEntry* dieBKE = &chipBKE->Die_book_keeping_records[transaction_list.front()->Address.DieID];
 
-		bool local = transaction_list.front()->UserIORequest->local;
+		bool local = transaction_list.front()->Local;//Only user transactions can keep their data on the chip
 
 		/*If this is not a die-interleaved command execution, and the channel is already busy,
 		* then something illegarl is happening*/
@@ -201,7 +201,7 @@ namespace SSD_Components {
 					targetChip->StartCMDXfer();
 					chipBKE->Status = ChipStatus::CMD_IN;
 					chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
-					Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()], this,
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()], this,
 						dieBKE, (int)NVDDR2_SimEventType::READ_CMD_ADDR_TRANSFERRED);
 				} else {
 					dieBKE->DieInterleavedTime = suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
@@ -238,7 +238,7 @@ namespace SSD_Components {
 						targetChip->StartCMDDataInXfer();
 						chipBKE->Status = ChipStatus::CMD_DATA_IN;
 						chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time;
-						Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time,
+						Simulator->Register_sim_event_with_payload(Simulator->Time() + suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time,
 							this, dieBKE, (int)NVDDR2_SimEventType::PROGRAM_CMD_ADDR_DATA_TRANSFERRED);
 					} else {
 						dieBKE->DieInterleavedTime = suspendTime + target_channel->ProgramCommandTime[transaction_list.size()] + data_transfer_time;
@@ -269,7 +269,7 @@ namespace SSD_Components {
 						targetChip->StartCMDXfer();
 						chipBKE->Status = ChipStatus::CMD_IN;
 						chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
-						Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()], this,
+						Simulator->Register_sim_event_with_payload(Simulator->Time() + suspendTime + target_channel->ReadCommandTime[transaction_list.size()], this,
 							dieBKE, (int)NVDDR2_SimEventType::READ_CMD_ADDR_TRANSFERRED);
 					} else {
 						dieBKE->DieInterleavedTime = suspendTime + target_channel->ReadCommandTime[transaction_list.size()];
@@ -301,7 +301,7 @@ namespace SSD_Components {
 					targetChip->StartCMDXfer();
 					chipBKE->Status = ChipStatus::CMD_IN;
 					chipBKE->Last_transfer_finish_time = Simulator->Time() + suspendTime + target_channel->EraseCommandTime[transaction_list.size()];
-					Simulator->Register_sim_event(Simulator->Time() + suspendTime + target_channel->EraseCommandTime[transaction_list.size()],
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + suspendTime + target_channel->EraseCommandTime[transaction_list.size()],
 						this, dieBKE, (int)NVDDR2_SimEventType::ERASE_SETUP_COMPLETED);
 				} else {
 					dieBKE->DieInterleavedTime = suspendTime + target_channel->EraseCommandTime[transaction_list.size()];
@@ -319,7 +319,7 @@ namespace SSD_Components {
 		}
 
 		target_channel->SetStatus(BusChannelStatus::BUSY, targetChip);
-		transaction_list.front()->UserIORequest->channel_busy_callback();
+		broadcastChannelStatusChangeSignal(target_channel->ChannelID, BusChannelStatus::BUSY);
 	}
 
 	void NVM_PHY_ONFI_NVDDR2::Change_memory_status_preconditioning(const NVM::NVM_Memory_Address* address, const void* status_info)
@@ -340,7 +340,7 @@ namespace SSD_Components {
 
 	void NVM_PHY_ONFI_NVDDR2::Execute_simulator_event(MQSimEngine::Sim_Event* ev)
 	{
-		DieBookKeepingEntry* dieBKE = (DieBookKeepingEntry*)ev->Parameters;
+		DieBookKeepingEntry* dieBKE = ev->Get_payload<DieBookKeepingEntry*>();
 		flash_channel_ID_type channel_id = dieBKE->ActiveTransactions.front()->Address.ChannelID;
 		ONFI_Channel_NVDDR2* targetChannel = channels[channel_id];
 		NVM::FlashMemory::Flash_Chip* targetChip = targetChannel->Chips[dieBKE->ActiveTransactions.front()->Address.ChipID];
@@ -361,7 +361,7 @@ namespace SSD_Components {
 				} else {
 					chipBKE->Status = ChipStatus::READING;
 					targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
-					dieBKE->ActiveTransactions.front()->UserIORequest->channel_idle_callback();
+					broadcastChannelStatusChangeSignal(channel_id, BusChannelStatus::IDLE);
 				}
 				break;
 			case NVDDR2_SimEventType::ERASE_SETUP_COMPLETED:
@@ -378,7 +378,7 @@ namespace SSD_Components {
 				} else {
 					chipBKE->Status = ChipStatus::ERASING;
 					targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
-					dieBKE->ActiveTransactions.front()->UserIORequest->channel_idle_callback();
+					broadcastChannelStatusChangeSignal(channel_id, BusChannelStatus::IDLE);
 				}
 				break;
 			case NVDDR2_SimEventType::PROGRAM_CMD_ADDR_DATA_TRANSFERRED:
@@ -397,17 +397,13 @@ namespace SSD_Components {
 				} else {
 					chipBKE->Status = ChipStatus::WRITING;
 					targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
-					dieBKE->ActiveTransactions.front()->UserIORequest->channel_idle_callback();
+					broadcastChannelStatusChangeSignal(channel_id, BusChannelStatus::IDLE);
 				}
 				break;
 			case NVDDR2_SimEventType::READ_DATA_TRANSFERRED:
 				//DEBUG2("Chip " << targetChip->ChannelID << ", " << targetChip->ChipID << ", " << dieBKE->ActiveTransactions.front()->Address.DieID << ": READ_DATA_TRANSFERRED ")
 				targetChip->EndDataOutXfer(dieBKE->ActiveCommand);
 				copy_read_data_to_transaction((NVM_Transaction_Flash_RD*)dieBKE->ActiveTransfer, dieBKE->ActiveCommand);
-	#if 0
-				if (tr->ExecutionMode != ExecutionModeType::COPYBACK)
-	#endif
-				dieBKE->ActiveTransactions.front()->UserIORequest->channel_idle_callback();
 
 				broadcastTransactionServicedSignal(dieBKE->ActiveTransfer);
 
@@ -437,6 +433,7 @@ namespace SSD_Components {
 					}
 				}
 				targetChannel->SetStatus(BusChannelStatus::IDLE, targetChip);
+				broadcastChannelStatusChangeSignal(channel_id, BusChannelStatus::IDLE);
 				break;
 			default:
 				PRINT_ERROR("Unknown simulation event specified for NVM_PHY_ONFI_NVDDR2!")
@@ -457,7 +454,7 @@ namespace SSD_Components {
 			}
 			targetChip->StartCMDXfer();
 			waitingChipBKE->Status = ChipStatus::CMD_IN;
-			Simulator->Register_sim_event(Simulator->Time() + this->channels[channel_id]->ProgramCommandTime[waitingBKE->ActiveTransactions.size()],
+			Simulator->Register_sim_event_with_payload(Simulator->Time() + this->channels[channel_id]->ProgramCommandTime[waitingBKE->ActiveTransactions.size()],
 				this, waitingBKE, (int)NVDDR2_SimEventType::PROGRAM_COPYBACK_CMD_ADDR_TRANSFERRED);
 			waitingChipBKE->OngoingDieCMDTransfers.push(waitingBKE);
 
@@ -469,7 +466,7 @@ namespace SSD_Components {
 
 			WaitingCopybackWrites[channel_id].pop_front();
 			channels[channel_id]->SetStatus(BusChannelStatus::BUSY, targetChip);
-			waitingBKE->ActiveTransactions.front()->UserIORequest->channel_busy_callback();
+			broadcastChannelStatusChangeSignal(channel_id, BusChannelStatus::BUSY);
 
 			return;
 		} else if (WaitingMappingRead_TX[channel_id].size() > 0) {
@@ -576,11 +573,11 @@ namespace SSD_Components {
 				}
 				chip->StartCMDXfer();
 				chipBKE->Status = ChipStatus::CMD_IN;
-				Simulator->Register_sim_event(Simulator->Time() + _my_instance->channels[chip->ChannelID]->ProgramCommandTime[dieBKE->ActiveTransactions.size()],
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + _my_instance->channels[chip->ChannelID]->ProgramCommandTime[dieBKE->ActiveTransactions.size()],
 					_my_instance, dieBKE, (int)NVDDR2_SimEventType::PROGRAM_COPYBACK_CMD_ADDR_TRANSFERRED);
 				chipBKE->OngoingDieCMDTransfers.push(dieBKE);
 				_my_instance->channels[chip->ChannelID]->SetStatus(BusChannelStatus::BUSY, chip);
-				dieBKE->ActiveTransactions.front()->UserIORequest->channel_busy_callback();
+				_my_instance->broadcastChannelStatusChangeSignal(chip->ChannelID, BusChannelStatus::BUSY);
 
 				dieBKE->Expected_finish_time = Simulator->Time() + _my_instance->channels[chip->ChannelID]->ProgramCommandTime[dieBKE->ActiveTransactions.size()]
 					+ chip->Get_command_execution_latency(dieBKE->ActiveCommand->CommandCode, dieBKE->ActiveCommand->Address[0].PageID);
@@ -653,12 +650,12 @@ namespace SSD_Components {
 		dieBKE->ActiveTransfer = tr;
 		channels[tr->Address.ChannelID]->Chips[tr->Address.ChipID]->StartDataOutXfer();
 		chipBKE->Status = ChipStatus::DATA_OUT;
-		Simulator->Register_sim_event(Simulator->Time() + NVDDR2DataOutTransferTime(tr->Data_and_metadata_size_in_byte, channels[tr->Address.ChannelID]),
+		Simulator->Register_sim_event_with_payload(Simulator->Time() + NVDDR2DataOutTransferTime(tr->Data_and_metadata_size_in_byte, channels[tr->Address.ChannelID]),
 			this, dieBKE, (int)NVDDR2_SimEventType::READ_DATA_TRANSFERRED);
 
 		tr->STAT_transfer_time += NVDDR2DataOutTransferTime(tr->Data_and_metadata_size_in_byte, channels[tr->Address.ChannelID]);
 		channels[tr->Address.ChannelID]->SetStatus(BusChannelStatus::BUSY, channels[tr->Address.ChannelID]->Chips[tr->Address.ChipID]);
-		tr->UserIORequest->channel_busy_callback();
+		broadcastChannelStatusChangeSignal(tr->Address.ChannelID, BusChannelStatus::BUSY);
 	}
 
 	void NVM_PHY_ONFI_NVDDR2::perform_interleaved_cmd_data_transfer(NVM::FlashMemory::Flash_Chip* chip, DieBookKeepingEntry* bookKeepingEntry)
@@ -672,33 +669,33 @@ namespace SSD_Components {
 			case Transaction_Type::READ:
 				chip->StartCMDXfer();
 				bookKeepingTable[chip->ChannelID][chip->ChipID].Status = ChipStatus::CMD_IN;
-				Simulator->Register_sim_event(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
 					this, bookKeepingEntry, (int)NVDDR2_SimEventType::READ_CMD_ADDR_TRANSFERRED);
 				break;
 			case Transaction_Type::WRITE:
 				if (((NVM_Transaction_Flash_WR*)bookKeepingEntry->ActiveTransactions.front())->RelatedRead == NULL) {
 					chip->StartCMDDataInXfer();
 					bookKeepingTable[chip->ChannelID][chip->ChipID].Status = ChipStatus::CMD_DATA_IN;
-					Simulator->Register_sim_event(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
 						this, bookKeepingEntry, (int)NVDDR2_SimEventType::PROGRAM_CMD_ADDR_DATA_TRANSFERRED);
 				} else {
 					chip->StartCMDXfer();
 					bookKeepingTable[chip->ChannelID][chip->ChipID].Status = ChipStatus::CMD_IN;
-					Simulator->Register_sim_event(Simulator->Time() + bookKeepingEntry->DieInterleavedTime, this,
+					Simulator->Register_sim_event_with_payload(Simulator->Time() + bookKeepingEntry->DieInterleavedTime, this,
 						bookKeepingEntry, (int)NVDDR2_SimEventType::READ_CMD_ADDR_TRANSFERRED);
 				}
 				break;
 			case Transaction_Type::ERASE:
 				chip->StartCMDXfer();
 				bookKeepingTable[chip->ChannelID][chip->ChipID].Status = ChipStatus::CMD_IN;
-				Simulator->Register_sim_event(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
+				Simulator->Register_sim_event_with_payload(Simulator->Time() + bookKeepingEntry->DieInterleavedTime,
 					this, bookKeepingEntry, (int)NVDDR2_SimEventType::ERASE_SETUP_COMPLETED);
 				break;
 			default:
 				PRINT_ERROR("NVMController_NVDDR2: Uknown flash transaction type!")
 		}
 		target_channel->SetStatus(BusChannelStatus::BUSY, chip);
-		bookKeepingEntry->ActiveTransactions.front()->UserIORequest->channel_busy_callback();
+		broadcastChannelStatusChangeSignal(target_channel->ChannelID, BusChannelStatus::BUSY);
 	}
 
 	inline void NVM_PHY_ONFI_NVDDR2::send_resume_command_to_chip(NVM::FlashMemory::Flash_Chip* chip, ChipBookKeepingEntry* chipBKE)
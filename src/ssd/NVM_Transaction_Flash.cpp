@@ -1,18 +1,83 @@
+#include <cstdlib>
+#include <new>
+#include <vector>
 #include "NVM_Transaction_Flash.h"
 
+#define TRANSACTION_POOL_GRANULARITY 16 //The block sizes of the pool are multiples of this value
+#define TRANSACTION_POOL_SIZE_CLASSES 64
 
 namespace SSD_Components
 {
+	/*
+	* The free lists are indexed by the object size, which operator delete receives since the transactions have a
+	* virtual destructor. All blocks are allocated with malloc, so a block that is released while pooling is
+	* disabled is simply freed.
+	*/
+	struct Transaction_Pool
+	{
+		Transaction_Pool() : Enabled(false) {}
+		~Transaction_Pool()
+		{
+			for (auto &free_blocks : Free_blocks) {
+				for (auto block : free_blocks) {
+					std::free(block);
+				}
+			}
+		}
+		bool Enabled;
+		std::vector<void*> Free_blocks[TRANSACTION_POOL_SIZE_CLASSES];
+	};
+
+	static thread_local Transaction_Pool transaction_pool;
+
+	void NVM_Transaction_Flash::Enable_pooling(bool enabled)
+	{
+		transaction_pool.Enabled = enabled;
+	}
+
+	void* NVM_Transaction_Flash::operator new(size_t size)
+	{
+		size_t size_class = (size + TRANSACTION_POOL_GRANULARITY - 1) / TRANSACTION_POOL_GRANULARITY;
+		if (transaction_pool.Enabled && size_class < TRANSACTION_POOL_SIZE_CLASSES && !transaction_pool.Free_blocks[size_class].empty()) {
+			void* block = transaction_pool.Free_blocks[size_class].back();
+			transaction_pool.Free_blocks[size_class].pop_back();
+			return block;
+		}
+
+		void* block = std::malloc(size_class * TRANSACTION_POOL_GRANULARITY);
+		if (block == NULL) {
+			throw std::bad_alloc();
+		}
+
+		return block;
+	}
+
+	void NVM_Transaction_Flash::operator delete(void* transaction, size_t size)
+	{
+		if (transaction == NULL) {
+			return;
+		}
+
+		size_t size_class = (size + TRANSACTION_POOL_GRANULARITY - 1) / TRANSACTION_POOL_GRANULARITY;
+		if (transaction_pool.Enabled && size_class < TRANSACTION_POOL_SIZE_CLASSES) {
+			transaction_pool.Free_blocks[size_class].push_back(transaction);
+		} else {
+			std::free(transaction);
+		}
+	}
+
 	NVM_Transaction_Flash::NVM_Transaction_Flash(Transaction_Source_Type source, Transaction_Type type, stream_id_type stream_id,
 		unsigned int data_size_in_byte, LPA_type lpa, PPA_type ppa, User_Request* user_request, IO_Flow_Priority_Class::Priority priority_class) :
 		NVM_Transaction(stream_id, source, type, user_request, priority_class),
-		Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false), FLIN_Barrier(false)
+		Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false), FLIN_Barrier(false),
+		Local(user_request != NULL && user_request->local)
 	{
 	}
 	
 	NVM_Transaction_Flash::NVM_Transaction_Flash(Transaction_Source_Type source, Transaction_Type type, stream_id_type stream_id,
 		unsigned int data_size_in_byte, LPA_type lpa, PPA_type ppa, const NVM::FlashMemory::Physical_Page_Address& address, User_Request* user_request, IO_Flow_Priority_Class::Priority priority_class) :
-		NVM_Transaction(stream_id, source, type, user_request, priority_class), Address(address), Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false)
+		NVM_Transaction(stream_id, source, type, user_request, priority_class), Address(address), Data_and_metadata_size_in_byte(data_size_in_byte), LPA(lpa), PPA(ppa), Physical_address_determined(false), FLIN_Barrier(false),
+		Local(user_request != NULL && user_request->local)
 	{
 	}
 }
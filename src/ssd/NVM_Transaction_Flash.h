@@ -34,6 +34,12 @@ namespace SSD_Components
 		bool Physical_address_determined;
 		sim_time_type Estimated_alone_waiting_time;//Used in scheduling methods, such as FLIN, where fairness and QoS is considered in scheduling
 		bool FLIN_Barrier;//Especially used in queue reordering in FLIN scheduler
+		bool Local;//Copied from the user request, which may already be deleted when the transaction is executed (e.g., for cached writes)
+
+		//Flash transactions are created and deleted at a very high rate, so libmqsim recycles their memory through per-thread free lists
+		static void* operator new(size_t size);
+		static void operator delete(void* transaction, size_t size);
+		static void Enable_pooling(bool enabled);//Only affects the calling thread
 	private:
 
 	};
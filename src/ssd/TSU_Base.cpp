@@ -5,7 +5,7 @@
 
 namespace SSD_Components
 {
-	TSU_Base* TSU_Base::_my_instance = NULL;
+	thread_local TSU_Base* TSU_Base::_my_instance = NULL;
 
 	TSU_Base::TSU_Base(const sim_object_id_type& id, FTL* ftl, NVM_PHY_ONFI_NVDDR2* NVMController, Flash_Scheduling_Type Type,
 		unsigned int ChannelCount, unsigned int chip_no_per_channel, unsigned int DieNoPerChip, unsigned int PlaneNoPerDie,
@@ -65,6 +65,32 @@ namespace SSD_Components
 		}
 	}
 
+	/*
+	* Transactions that are scheduled in the same nanosecond are dispatched together, after all of them are queued,
+	* instead of one call to Schedule() at a time. A chip may therefore serve a transaction that arrived later in the
+	* same nanosecond first (e.g., a read that can suspend a program), so results differ slightly from immediate dispatch.
+	*/
+	void TSU_Base::Execute_end_of_timestep_callback()
+	{
+		for (flash_channel_ID_type channelID = 0; channelID < channel_count; channelID++)
+		{
+			if (_NVMController->Get_channel_status(channelID) == BusChannelStatus::IDLE)
+			{
+				for (unsigned int i = 0; i < chip_no_per_channel; i++)
+				{
+					NVM::FlashMemory::Flash_Chip *chip = _NVMController->Get_chip(channelID, Round_robin_turn_of_channel[channelID]);
+					//The TSU does not check if the chip is idle or not since it is possible to suspend a busy chip and issue a new command
+					process_chip_requests(chip);
+					Round_robin_turn_of_channel[channelID] = (flash_chip_ID_type)(Round_robin_turn_of_channel[channelID] + 1) % chip_no_per_channel;
+					if (_NVMController->Get_channel_status(chip->ChannelID) != BusChannelStatus::IDLE)
+					{
+						break;
+					}
+				}
+			}
+		}
+	}
+
 	void TSU_Base::Report_results_in_XML(std::string name_prefix, Utils::XmlWriter& xmlwriter)
 	{
 	}
@@ -63,6 +63,11 @@ public:
 		* be mixes of reads, writes, and erases.
 		*/
 	virtual void Schedule() = 0;
+	/* Schedule() only queues the received transactions. The queued transactions are dispatched to the
+		* idle channels once, after all the events of the current simulation time are executed, so that the
+		* transactions that are submitted by different events of the same time are scheduled together.
+		*/
+	void Execute_end_of_timestep_callback();
 	virtual void Report_results_in_XML(std::string name_prefix, Utils::XmlWriter &xmlwriter);
 
 protected:
@@ -79,7 +84,7 @@ protected:
 	sim_time_type eraseReasonableSuspensionTimeForWrite;
 	flash_chip_ID_type *Round_robin_turn_of_channel; //Used for round-robin service of the chips in channels
 
-	static TSU_Base *_my_instance;
+	static thread_local TSU_Base *_my_instance;
 	std::list<NVM_Transaction_Flash *> transaction_receive_slots;  //Stores the transactions that are received for sheduling
 	std::list<NVM_Transaction_Flash *> transaction_dispatch_slots; //Used to submit transactions to the channel controller
 	virtual bool service_read_transaction(NVM::FlashMemory::Flash_Chip *chip) = 0;
@@ -2,9 +2,9 @@
 
 namespace SSD_Components
 {
-	unsigned int User_Request::lastId = 0;
+	thread_local unsigned int User_Request::lastId = 0;
 
-	User_Request::User_Request() : Sectors_serviced_from_cache(0)
+	User_Request::User_Request() : Sectors_serviced_from_cache(0), local(false)
 	{
 		ID = "" + std::to_string(lastId++);
 		ToBeIgnored = false;
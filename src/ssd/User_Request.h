@@ -37,11 +37,8 @@ namespace SSD_Components
 		std::function<void(void)> finish_callback = nullptr;
 		// 2021.7.22
 		bool local;
-		// 2021.7.23
-		std::function<void(void)> channel_busy_callback = nullptr;
-		std::function<void(void)> channel_idle_callback = nullptr;
 	private:
-		static unsigned int lastId;
+		static thread_local unsigned int lastId;
 	};
 }
 
@@ -0,0 +1,80 @@
+#include <iostream>
+#include <string>
+#include "../host/Trace_Reader.h"
+
+using namespace std;
+
+//Converts an ASCII disk trace, or a trace in one of the native formats of Native_Trace_Definition.h, into the packed binary trace format, see Binary_Trace_Definition.h
+int main(int argc, char* argv[])
+{
+	Trace_File_Format format = Trace_File_Format::MQSIM;
+	int first_file_argument = 1;
+	if (argc == 5 && string(argv[1]) == "-f") {
+		string format_name = argv[2];
+		if (format_name == "MQSIM") {
+			format = Trace_File_Format::MQSIM;
+		} else if (format_name == "BLKPARSE") {
+			format = Trace_File_Format::BLKPARSE;
+		} else if (format_name == "MSR_CAMBRIDGE") {
+			format = Trace_File_Format::MSR_CAMBRIDGE;
+		} else if (format_name == "FIO_IOLOG") {
+			format = Trace_File_Format::FIO_IOLOG;
+		} else {
+			cerr << "Unknown trace file format: " << format_name << endl;
+			return 1;
+		}
+		first_file_argument = 3;
+	} else if (argc != 3) {
+		cerr << "Usage: MQSimTraceConverter [-f MQSIM|BLKPARSE|MSR_CAMBRIDGE|FIO_IOLOG] <input trace file> <binary trace file>" << endl;
+		return 1;
+	}
+	const char* input_file_path = argv[first_file_argument];
+	const char* output_file_path = argv[first_file_argument + 1];
+
+	//The MQSIM format is always read as ASCII here, since a binary input would only be copied
+	Host_Components::Trace_Reader* reader = format == Trace_File_Format::MQSIM ? new Host_Components::ASCII_Trace_Reader
+		: Host_Components::Trace_Reader::Create(input_file_path, format);
+	if (!reader->Open(input_file_path)) {
+		cerr << "Error while opening input trace file: " << input_file_path << endl;
+		delete reader;
+		return 1;
+	}
+	Host_Components::Binary_Trace_Writer writer;
+	if (!writer.Open(output_file_path)) {
+		cerr << "Error while creating output trace file: " << output_file_path << endl;
+		delete reader;
+		return 1;
+	}
+
+	Host_Components::Trace_Record record;
+	unsigned long long record_count = 0;
+	sim_time_type last_request_arrival_time = 0;
+	while (reader->Read_next(record)) {
+		if (record.Arrival_time < last_request_arrival_time) {
+			cerr << "Unexpected request arrival time: " << record.Arrival_time << " (request " << record_count + 1
+				<< ")\nMQSim expects request arrival times to be monotonically increasing in the input trace!" << endl;
+			delete reader;
+			return 1;
+		}
+		if (record.Device > UINT16_MAX) {
+			cerr << "Device number " << record.Device << " does not fit into the binary trace format (request " << record_count + 1 << ")" << endl;
+			delete reader;
+			return 1;
+		}
+		last_request_arrival_time = record.Arrival_time;
+		writer.Write(record);
+		record_count++;
+	}
+	if (reader->Get_discard_record_count() > 0 || reader->Get_flush_record_count() > 0) {
+		cout << "Skipped " << reader->Get_discard_record_count() << " discard and " << reader->Get_flush_record_count() << " flush records" << endl;
+	}
+	reader->Close();
+	delete reader;
+	if (!writer.Close()) {
+		cerr << "Error while writing output trace file: " << output_file_path << endl;
+		return 1;
+	}
+	cout << "Converted " << record_count << " requests from " << input_file_path << " to " << output_file_path << endl;
+
+	return 0;
+}
@@ -0,0 +1,46 @@
+#include "Alias_Table.h"
+
+namespace Utils
+{
+	Alias_Table::Alias_Table(const std::vector<double>& weights) : probability(weights.size(), 1.0), alias(weights.size())
+	{
+		double sum = 0;
+		for (auto weight : weights) {
+			sum += weight;
+		}
+
+		//Each column has an average height of 1; the columns below it are topped up from the ones above it
+		std::vector<double> scaled(weights.size());
+		std::vector<unsigned int> small, large;
+		for (unsigned int i = 0; i < weights.size(); i++) {
+			alias[i] = i;
+			scaled[i] = weights[i] * weights.size() / sum;
+			if (scaled[i] < 1.0) {
+				small.push_back(i);
+			} else {
+				large.push_back(i);
+			}
+		}
+		while (small.size() > 0 && large.size() > 0) {
+			unsigned int less = small.back(), more = large.back();
+			small.pop_back();
+			probability[less] = scaled[less];
+			alias[less] = more;
+			scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+			if (scaled[more] < 1.0) {
+				large.pop_back();
+				small.push_back(more);
+			}
+		}
+		//The columns that are left are full, up to rounding errors, and keep their probability of 1
+	}
+
+	unsigned int Alias_Table::Sample(RandomGenerator& random_generator)
+	{
+		unsigned int column = random_generator.Uniform_uint(0, (uint32_t)probability.size() - 1);
+		if (random_generator.FloatRandom() < probability[column]) {
+			return column;
+		}
+		return alias[column];
+	}
+}
@@ -0,0 +1,25 @@
+#ifndef ALIAS_TABLE_H
+#define ALIAS_TABLE_H
+
+#include <vector>
+#include "RandomGenerator.h"
+
+namespace Utils
+{
+	/*
+	* Draws indexes with probabilities proportional to a list of weights, in constant time, using the
+	* alias method as constructed by: M. D. Vose, "A linear algorithm for generating random numbers with
+	* a given distribution", IEEE TSE, 1991.
+	*/
+	class Alias_Table
+	{
+	public:
+		Alias_Table(const std::vector<double>& weights);
+		unsigned int Sample(RandomGenerator& random_generator);
+	private:
+		std::vector<double> probability;//The probability of keeping a column instead of taking its alias
+		std::vector<unsigned int> alias;
+	};
+}
+
+#endif // !ALIAS_TABLE_H
@@ -81,4 +81,14 @@ namespace Utils
 
 		return (p + 1) * norm;
 	}
-}
+
+	void CMRRandomGenerator::Save_checkpoint(Checkpoint_Writer& writer)
+	{
+		writer.Write_array(&s[0][0], 6);
+	}
+
+	void CMRRandomGenerator::Load_checkpoint(Checkpoint_Reader& reader)
+	{
+		reader.Read_array(&s[0][0], 6);
+	}
+}
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define CMR_RANDOM_GENERATOR_H
 
 #include <cstdint>
+#include "Checkpoint.h"
 
 namespace Utils
 {
@@ -11,6 +12,8 @@ namespace Utils
 			CMRRandomGenerator(int64_t n, int e);
 			void Advance(int64_t n, int e);
 			double NextDouble();
+			void Save_checkpoint(Checkpoint_Writer& writer);
+			void Load_checkpoint(Checkpoint_Reader& reader);
 		private:
 			double s[2][3];
 			static double norm, m1, m2, a12, a13, a21, a23;
@@ -0,0 +1,170 @@
+#include <atomic>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+#include "Checkpoint.h"
+#include "../sim/Engine.h"
+
+namespace Utils
+{
+	bool Checkpoint_Writer::Open(const std::string& file_path, uint64_t key)
+	{
+		//Each writer gets its own temporary file, since parallel simulations may write the same checkpoint at the same time
+		static std::atomic<unsigned int> writer_count(0);
+		this->file_path = file_path;
+		temporary_file_path = file_path + ".tmp." + std::to_string(getpid()) + "." + std::to_string(writer_count++);
+		file.open(temporary_file_path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open()) {
+			return false;
+		}
+
+		out = &file;
+		write_header(key);
+
+		return true;
+	}
+
+	void Checkpoint_Writer::Open_in_memory(uint64_t key)
+	{
+		file_path = "";
+		memory_buffer.str("");
+		out = &memory_buffer;
+		write_header(key);
+	}
+
+	void Checkpoint_Writer::write_header(uint64_t key)
+	{
+		Write(CHECKPOINT_MAGIC);
+		Write((uint32_t)CHECKPOINT_VERSION);
+		Write(key);
+	}
+
+	bool Checkpoint_Writer::Close()
+	{
+		if (out == NULL) {
+			return true;
+		}
+
+		Write(CHECKPOINT_MAGIC);
+		out = NULL;
+		if (!file.is_open()) {
+			return true;
+		}
+
+		file.close();
+		//rename replaces an existing checkpoint atomically, so readers never see a partially written file
+		if (file.fail() || std::rename(temporary_file_path.c_str(), file_path.c_str()) != 0) {
+			std::remove(temporary_file_path.c_str());
+			return false;
+		}
+
+		return true;
+	}
+
+	std::string Checkpoint_Writer::Get_memory_buffer() const
+	{
+		return memory_buffer.str();
+	}
+
+	bool Checkpoint_Reader::Open(const std::string& file_path, uint64_t key)
+	{
+		this->file_path = file_path;
+		file.open(file_path, std::ios::binary);
+		if (!file.is_open()) {
+			return false;
+		}
+
+		in = &file;
+		if (!read_header(key)) {
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool Checkpoint_Reader::Open_in_memory(const std::string& buffer, uint64_t key)
+	{
+		file_path = "in memory";
+		memory_buffer.str(buffer);
+		memory_buffer.clear();
+		in = &memory_buffer;
+		if (!read_header(key)) {
+			Close();
+			return false;
+		}
+
+		return true;
+	}
+
+	bool Checkpoint_Reader::read_header(uint64_t key)
+	{
+		uint64_t magic = 0, stored_key = 0, end_magic = 0;
+		uint32_t version = 0;
+		in->read((char*)&magic, sizeof(magic));
+		in->read((char*)&version, sizeof(version));
+		in->read((char*)&stored_key, sizeof(stored_key));
+		in->seekg(-(std::streamoff)sizeof(end_magic), std::ios::end);
+		in->read((char*)&end_magic, sizeof(end_magic));
+		if (!in->good() || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION || stored_key != key || end_magic != CHECKPOINT_MAGIC) {
+			return false;
+		}
+
+		in->seekg(sizeof(magic) + sizeof(version) + sizeof(stored_key), std::ios::beg);
+
+		return true;
+	}
+
+	void Checkpoint_Reader::Close()
+	{
+		if (file.is_open()) {
+			file.close();
+		}
+		memory_buffer.str("");
+		in = NULL;
+	}
+
+	void Checkpoint_Reader::check_read()
+	{
+		if (!in->good()) {
+			PRINT_ERROR("Unexpected end of the checkpoint " << file_path)
+		}
+	}
+
+	uint64_t Hash_string(const std::string& str, uint64_t hash)
+	{
+		for (unsigned char c : str) {
+			hash ^= c;
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+
+	bool Get_file_version(const std::string& file_path, std::string& version)
+	{
+		struct stat file_status;
+		if (stat(file_path.c_str(), &file_status) != 0) {
+			return false;
+		}
+
+		//A file may be rewritten within the same second, so the nanoseconds of the modification time are included where they are available
+#if defined(_WIN32)
+		long long modification_time_nsec = 0;
+#elif defined(__APPLE__)
+		long long modification_time_nsec = (long long)file_status.st_mtimespec.tv_nsec;
+#else
+		long long modification_time_nsec = (long long)file_status.st_mtim.tv_nsec;
+#endif
+		version = std::to_string((unsigned long long)file_status.st_size) + " " + std::to_string((long long)file_status.st_mtime)
+			+ "." + std::to_string(modification_time_nsec);
+
+		return true;
+	}
+}
@@ -0,0 +1,84 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+
+namespace Utils
+{
+#define CHECKPOINT_MAGIC 0x54504B434D49534DULL //"MSIMCKPT"
+#define CHECKPOINT_VERSION 1
+
+	/*
+	* A checkpoint file is a binary snapshot of the simulation state. It starts with a header
+	* that holds the magic number, the format version, and a key that identifies the configuration
+	* the snapshot belongs to, and ends with the magic number to detect truncated files.
+	* The reader only accepts a file whose header and key match, so that a stale checkpoint
+	* is never loaded into a differently configured simulation. Checkpoints can also be kept in
+	* memory, e.g., to hand a preconditioned state over to forked simulation processes.
+	*/
+	class Checkpoint_Writer
+	{
+	public:
+		bool Open(const std::string& file_path, uint64_t key);
+		void Open_in_memory(uint64_t key);
+		bool Close();//The file only becomes visible under its final name after it is completely written; returns false if it could not be written
+		std::string Get_memory_buffer() const;
+		template <typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are written to checkpoints");
+			out->write((const char*)&value, sizeof(T));
+		}
+		template <typename T>
+		void Write_array(const T* values, size_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are written to checkpoints");
+			out->write((const char*)values, sizeof(T) * count);
+		}
+	private:
+		std::ofstream file;
+		std::ostringstream memory_buffer;
+		std::ostream* out = NULL;
+		std::string file_path, temporary_file_path;
+		void write_header(uint64_t key);
+	};
+
+	class Checkpoint_Reader
+	{
+	public:
+		bool Open(const std::string& file_path, uint64_t key);//Returns false if the file does not exist or does not belong to key
+		bool Open_in_memory(const std::string& buffer, uint64_t key);
+		void Close();
+		template <typename T>
+		void Read(T& value)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are read from checkpoints");
+			in->read((char*)&value, sizeof(T));
+			check_read();
+		}
+		template <typename T>
+		void Read_array(T* values, size_t count)
+		{
+			static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values are read from checkpoints");
+			in->read((char*)values, sizeof(T) * count);
+			check_read();
+		}
+	private:
+		std::ifstream file;
+		std::istringstream memory_buffer;
+		std::istream* in = NULL;
+		std::string file_path;
+		bool read_header(uint64_t key);
+		void check_read();
+	};
+
+	uint64_t Hash_string(const std::string& str, uint64_t hash = 14695981039346656037ULL);//64-bit FNV-1a
+	//The size and modification time of a file, which identify its content in checkpoint keys; returns false if the file does not exist
+	bool Get_file_version(const std::string& file_path, std::string& version);
+}
+
+#endif // !CHECKPOINT_H
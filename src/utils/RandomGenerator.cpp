@@ -240,4 +240,16 @@ namespace Utils
 			return max - sqrt(max*max + y*max*middle - y*max*max - y*min*middle + y*max*min - max*min - max*middle + min*middle);
 		}
 	}
+
+	void RandomGenerator::Save_checkpoint(Checkpoint_Writer& writer)
+	{
+		rand->Save_checkpoint(writer);
+		writer.Write(Normal_z2);
+	}
+
+	void RandomGenerator::Load_checkpoint(Checkpoint_Reader& reader)
+	{
+		rand->Load_checkpoint(reader);
+		reader.Read(Normal_z2);
+	}
 }
\ No newline at end of file
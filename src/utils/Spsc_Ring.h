@@ -0,0 +1,89 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#define SPSC_RING_CACHE_LINE_SIZE 64
+
+namespace Utils
+{
+	/*
+	* A bounded lock-free ring that is shared by exactly one producer thread and one consumer thread.
+	* Each side only writes its own index, and the index of the other side is published with
+	* release/acquire ordering, so an entry is always completely written before it becomes visible.
+	* Both sides cache the last index they read from the other side to avoid touching its cache line
+	* on every operation.
+	*/
+	template <typename T>
+	class Spsc_Ring
+	{
+	public:
+		explicit Spsc_Ring(uint32_t capacity) : entries(capacity), mask(capacity - 1), head(0), cached_tail(0), tail(0), cached_head(0)
+		{
+		}
+
+		uint32_t Capacity() const
+		{
+			return mask + 1;
+		}
+
+		//Producer side
+		bool Push(const T& entry)
+		{
+			uint64_t current_tail = tail.load(std::memory_order_relaxed);
+			if (current_tail - cached_head > mask) {
+				cached_head = head.load(std::memory_order_acquire);
+				if (current_tail - cached_head > mask) {
+					return false;
+				}
+			}
+			entries[current_tail & mask] = entry;
+			tail.store(current_tail + 1, std::memory_order_release);
+
+			return true;
+		}
+
+		//Consumer side: returns the oldest entry without removing it, or NULL if the ring is empty
+		const T* Front()
+		{
+			uint64_t current_head = head.load(std::memory_order_relaxed);
+			if (current_head == cached_tail) {
+				cached_tail = tail.load(std::memory_order_acquire);
+				if (current_head == cached_tail) {
+					return NULL;
+				}
+			}
+
+			return &entries[current_head & mask];
+		}
+
+		//Consumer side: must only be called after Front() returned an entry
+		void Pop_front()
+		{
+			head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+		}
+
+		bool Pop(T& entry)
+		{
+			const T* front = Front();
+			if (front == NULL) {
+				return false;
+			}
+			entry = *front;
+			Pop_front();
+
+			return true;
+		}
+	private:
+		std::vector<T> entries;
+		const uint64_t mask;//The capacity must be a power of two
+		alignas(SPSC_RING_CACHE_LINE_SIZE) std::atomic<uint64_t> head;//Written by the consumer
+		uint64_t cached_tail;
+		alignas(SPSC_RING_CACHE_LINE_SIZE) std::atomic<uint64_t> tail;//Written by the producer
+		uint64_t cached_head;
+	};
+}
+
+#endif // !SPSC_RING_H
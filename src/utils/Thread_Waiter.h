@@ -0,0 +1,62 @@
+#ifndef THREAD_WAITER_H
+#define THREAD_WAITER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#define THREAD_WAITER_SPIN_COUNT 256
+
+namespace Utils
+{
+	/*
+	* Lets one thread wait for a condition that another thread changes. The waiter yields for a bounded
+	* number of rounds, which covers the short waits of tightly coupled threads, and then blocks on a
+	* condition variable. The notifier only takes the mutex if a waiter is blocked. Both sides issue a full
+	* fence between their own write and their read of the other side, so either the notifier sees the
+	* blocked waiter or the waiter sees the changed condition.
+	*/
+	class Thread_Waiter
+	{
+	public:
+		Thread_Waiter() : blocked_waiters(0) {}
+
+		template <typename Predicate>
+		void Wait(Predicate ready)
+		{
+			for (int round = 0; round < THREAD_WAITER_SPIN_COUNT; round++) {
+				if (ready()) {
+					return;
+				}
+				std::this_thread::yield();
+			}
+
+			blocked_waiters.fetch_add(1, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				while (!ready()) {
+					condition.wait(lock);
+				}
+			}
+			blocked_waiters.fetch_sub(1, std::memory_order_relaxed);
+		}
+
+		//Must be called after the condition of the waiter is changed
+		void Notify()
+		{
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (blocked_waiters.load(std::memory_order_relaxed) > 0) {
+				std::lock_guard<std::mutex> lock(mutex);
+				condition.notify_all();
+			}
+		}
+	private:
+		std::atomic<int> blocked_waiters;
+		std::mutex mutex;
+		std::condition_variable condition;
+	};
+}
+
+#endif // !THREAD_WAITER_H
@@ -45,6 +45,8 @@ namespace Utils
 		of write operations to the hot data is denoted as r*/
 		double Ratio_of_hot_addresses_to_whole_working_set;//The f parameter in the Rosenblum hot/cold model
 		double Ratio_of_traffic_accessing_hot_region;//The r parameter in the Rosenblum hot/cold model
+		double Zipfian_exponent;
+		std::vector<double> Tier_address_ratios, Tier_traffic_ratios;//The tiers of the multi-tier distribution, in the order of the addresses
 		int random_address_generator_seed;
 		int random_hot_cold_generator_seed;
 		int random_hot_address_generator_seed;
@@ -58,6 +60,7 @@ namespace Utils
 
 		Utils::Request_Generator_Type generator_type;
 		unsigned int Request_queue_depth;
+		sim_time_type Think_time;//The delay of the QUEUE_DEPTH generator between a completion and the next request
 		int random_time_interval_generator_seed;
 		sim_time_type Average_inter_arrival_time_nano_sec;
 
@@ -11,8 +11,9 @@ namespace Utils
 	bool XmlWriter::Open(const std::string strFile) {
 
 		outFile.open(strFile);
-		if (outFile.is_open()) {
-			outFile << "<?xml version=\"1.0\" encoding=\"us-ascii\"?>\n";
+		out = &outFile;
+		if (is_open()) {
+			*out << "<?xml version=\"1.0\" encoding=\"us-ascii\"?>\n";
 			indent = 0;
 			openTags = 0;
 			openElements = 0;
@@ -22,21 +23,41 @@ namespace Utils
 
 		return false;
 	}
+
+	void XmlWriter::Open_in_memory()
+	{
+		memoryBuffer.str("");
+		out = &memoryBuffer;
+		indent = 0;
+		openTags = 0;
+		openElements = 0;
+	}
+
+	std::string XmlWriter::Get_memory_buffer() const
+	{
+		return memoryBuffer.str();
+	}
 	
 	void XmlWriter::Close()
 	{
 		if (outFile.is_open()) {
 			outFile.close();
 		}
+		out = NULL;
+	}
+
+	bool XmlWriter::is_open()
+	{
+		return out == &memoryBuffer || (out == &outFile && outFile.is_open());
 	}
 	
 	void XmlWriter::Write_open_tag(const std::string openTag) {
-		if (outFile.is_open()) {
+		if (is_open()) {
 			for (int i = 0; i < indent; i++) {
-				outFile << "\t";
+				*out << "\t";
 			}
 			tempOpenTag.resize(openTags + 1);
-			outFile << "<" << openTag << ">\n";
+			*out << "<" << openTag << ">\n";
 			tempOpenTag[openTags] = openTag;
 			indent += 1;
 			openTags += 1;
@@ -47,24 +68,24 @@ namespace Utils
 	
 	void XmlWriter::Write_attribute_string(const std::string attribute_name, const std::string attribute_value)
 	{
-		if (outFile.is_open()) {
+		if (is_open()) {
 			for (int i = 0; i < indent + 1; i++) {
-				outFile << "\t";
+				*out << "\t";
 			}
 
-			outFile << " <" << attribute_name + ">" + attribute_value + "</" << attribute_name + ">\n";
+			*out << " <" << attribute_name + ">" + attribute_value + "</" << attribute_name + ">\n";
 		} else {
 			PRINT_ERROR("The XML output file is closed. Unable to write to file");
 		}
 	}
 	
 	void XmlWriter::Write_close_tag() {
-		if (outFile.is_open()) {
+		if (is_open()) {
 			indent -= 1;
 			for (int i = 0; i < indent; i++) {
-				outFile << "\t";
+				*out << "\t";
 			}
-			outFile << "</" << tempOpenTag[openTags - 1] << ">\n";
+			*out << "</" << tempOpenTag[openTags - 1] << ">\n";
 			tempOpenTag.resize(openTags - 1);
 			openTags -= 1;
 		} else {
@@ -73,14 +94,14 @@ namespace Utils
 	}
 	
 	void XmlWriter::Write_start_element_tag(const std::string elementTag) {
-		if (outFile.is_open()) {
+		if (is_open()) {
 			for (int i = 0; i < indent; i++) {
-				outFile << "\t";
+				*out << "\t";
 			}
 			tempElementTag.resize(openElements + 1);
 			tempElementTag[openElements] = elementTag;
 			openElements += 1;
-			outFile << "<" << elementTag;
+			*out << "<" << elementTag;
 		} else {
 			PRINT_ERROR("The XML output file is closed. Unable to write to file");
 		}
@@ -88,8 +109,8 @@ namespace Utils
 
 	void XmlWriter::Write_end_element_tag()
 	{
-		if (outFile.is_open()) {
-			outFile << "/>\n";
+		if (is_open()) {
+			*out << "/>\n";
 			tempElementTag.resize(openElements - 1);
 			openElements -= 1;
 		} else {
@@ -99,8 +120,8 @@ namespace Utils
 
 	void XmlWriter::Write_attribute(const std::string outAttribute)
 	{
-		if (outFile.is_open()) {
-			outFile << " " << outAttribute;
+		if (is_open()) {
+			*out << " " << outAttribute;
 		} else {
 			PRINT_ERROR("The XML output file is closed. Unable to write to file");
 		}
@@ -108,9 +129,9 @@ namespace Utils
 
 	void XmlWriter::Write_attribute_string_inline(const std::string attribute_name, const std::string attribute_value)
 	{
-		if (outFile.is_open()) {
-			outFile << " ";
-			outFile << attribute_name + "=\"" + attribute_value + "\"";
+		if (is_open()) {
+			*out << " ";
+			*out << attribute_name + "=\"" + attribute_value + "\"";
 		} else {
 			PRINT_ERROR("The XML output file is closed. Unable to write to file");
 		}
@@ -118,8 +139,8 @@ namespace Utils
 
 	void XmlWriter::Write_string(const std::string outString)
 	{
-		if (outFile.is_open()) {
-			outFile << ">" << outString;
+		if (is_open()) {
+			*out << ">" << outString;
 		} else {
 			PRINT_ERROR("The XML output file is closed. Unable to write to file");
 		}
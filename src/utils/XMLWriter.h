@@ -3,6 +3,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -11,6 +12,8 @@ namespace Utils
 	class XmlWriter {
 	public:
 		bool Open(const std::string);
+		void Open_in_memory();//The XML text is kept in a string buffer instead of a file, e.g., to compute a hash of a parameter set
+		std::string Get_memory_buffer() const;
 		void Close();
 		bool exists(const std::string);
 		void Write_open_tag(const std::string);
@@ -23,11 +26,14 @@ namespace Utils
 		void Write_attribute_string_inline(const std::string attribute_name, const std::string attribute_value);
 	private:
 		std::ofstream outFile;
+		std::ostringstream memoryBuffer;
+		std::ostream* out = NULL;
 		int indent;
 		int openTags;
 		int openElements;
 		std::vector<std::string> tempOpenTag;
 		std::vector<std::string> tempElementTag;
+		bool is_open();
 	};
 }
 
@@ -0,0 +1,89 @@
+#include <cmath>
+#include "Zipfian_Generator.h"
+
+namespace Utils
+{
+	//log1p(x)/x, which is accurate for small values of x
+	static double log1p_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8) {
+			return std::log1p(x) / x;
+		}
+		return 1 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+	}
+
+	//expm1(x)/x, which is accurate for small values of x
+	static double expm1_over_x(double x)
+	{
+		if (std::fabs(x) > 1e-8) {
+			return std::expm1(x) / x;
+		}
+		return 1 + x * 0.5 * (1 + x * (1.0 / 3.0) * (1 + 0.25 * x));
+	}
+
+	Zipfian_Generator::Zipfian_Generator(uint64_t number_of_elements, double exponent) :
+		number_of_elements(number_of_elements), exponent(exponent)
+	{
+		h_integral_x1 = h_integral(1.5) - 1;
+		h_integral_number_of_elements = h_integral((double)number_of_elements + 0.5);
+		s = 2 - h_integral_inverse(h_integral(2.5) - h(2));
+	}
+
+	uint64_t Zipfian_Generator::Sample(RandomGenerator& random_generator)
+	{
+		while (true) {
+			double u = h_integral_number_of_elements + random_generator.FloatRandom() * (h_integral_x1 - h_integral_number_of_elements);
+			double x = h_integral_inverse(u);
+			uint64_t k = x < 1.5 ? 1 : (uint64_t)(x + 0.5);
+			if (k > number_of_elements) {
+				k = number_of_elements;
+			}
+			//Most of the samples are accepted by the first test, without evaluating h_integral
+			if ((double)k - x <= s || u >= h_integral((double)k + 0.5) - h((double)k)) {
+				return k;
+			}
+		}
+	}
+
+	double Zipfian_Generator::Top_ranks_share(uint64_t rank_count) const
+	{
+		if (rank_count >= number_of_elements) {
+			return 1.0;
+		}
+		//The weight of rank 1 is exact, and the sum of the other weights is approximated by the integral of h, like in Sample
+		return (h_integral((double)rank_count + 0.5) - h_integral_x1) / (h_integral_number_of_elements - h_integral_x1);
+	}
+
+	uint64_t Zipfian_Generator::Above_average_rank_count() const
+	{
+		//Rank k is above the average if 1/k^exponent is larger than the sum of the weights over N
+		double average_weight = (h_integral_number_of_elements - h_integral_x1) / (double)number_of_elements;
+		double rank = std::pow(average_weight, -1.0 / exponent);
+		if (rank >= (double)number_of_elements) {
+			return number_of_elements;
+		}
+		return (uint64_t)rank;
+	}
+
+	//h(x) = 1/x^exponent
+	double Zipfian_Generator::h(double x) const
+	{
+		return std::exp(-exponent * std::log(x));
+	}
+
+	//The integral of h, (x^(1-exponent) - 1)/(1 - exponent), which is log(x) for an exponent of 1
+	double Zipfian_Generator::h_integral(double x) const
+	{
+		double log_x = std::log(x);
+		return expm1_over_x((1 - exponent) * log_x) * log_x;
+	}
+
+	double Zipfian_Generator::h_integral_inverse(double x) const
+	{
+		double t = x * (1 - exponent);
+		if (t < -1) {
+			t = -1;//Limits the result to 0 against rounding errors
+		}
+		return std::exp(log1p_over_x(t) * x);
+	}
+}
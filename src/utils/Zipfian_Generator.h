@@ -0,0 +1,34 @@
+#ifndef ZIPFIAN_GENERATOR_H
+#define ZIPFIAN_GENERATOR_H
+
+#include <cstdint>
+#include "RandomGenerator.h"
+
+namespace Utils
+{
+	/*
+	* Draws ranks in the range 1 to N, where rank k has a probability proportional to 1/k^exponent.
+	* Based on the rejection-inversion method of: W. Hormann and G. Derflinger, "Rejection-inversion to
+	* generate variates from monotone discrete distributions", ACM TOMACS, 1996.
+	* Sampling takes a constant expected time and no memory, whatever the value of N.
+	*/
+	class Zipfian_Generator
+	{
+	public:
+		Zipfian_Generator(uint64_t number_of_elements, double exponent);
+		uint64_t Sample(RandomGenerator& random_generator);
+		double Top_ranks_share(uint64_t rank_count) const;//The approximate share of the samples that fall into ranks 1 to rank_count
+		uint64_t Above_average_rank_count() const;//The number of ranks whose probability is larger than 1/N
+	private:
+		uint64_t number_of_elements;
+		double exponent;
+		double h_integral_x1;
+		double h_integral_number_of_elements;
+		double s;
+		double h(double x) const;
+		double h_integral(double x) const;
+		double h_integral_inverse(double x) const;
+	};
+}
+
+#endif // !ZIPFIAN_GENERATOR_H